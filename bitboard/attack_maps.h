@@ -0,0 +1,189 @@
+#ifndef BITBOARD_ATTACK_MAPS_H
+#define BITBOARD_ATTACK_MAPS_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/board.h"
+#include "bitboard/lookup_table/knight.h"
+#include "bitboard/lookup_table/piece.h"
+#include "bitboard/move.h"
+#include "bitboard/pieces.h"
+#include "bitboard/position.h"
+#include "bitboard/shift.h"
+#include "bitboard/sliding_attacks.h"
+#include "hardware/trailing_zeros_count.h"
+
+#include <array>
+#include <cstdint>
+#include <tuple>
+
+namespace Chess
+{
+
+/// @brief Squares attacked by each kind of piece of each side, indexed like the boards of a position (e.g. kWhiteBoard
+/// + kKnight). The board of a side itself (e.g. kWhiteBoard) holds all squares attacked by that side.
+///
+/// Attacks of sliders include the first blocker of either side, i.e. own pieces count as protected.
+struct AttackMaps
+{
+    Bitboard operator[](const std::size_t index) const { return boards_[index]; }
+
+    std::array<Bitboard, kNumberOfBoards> boards_{};
+};
+
+inline bool operator==(const AttackMaps& a, const AttackMaps& b)
+{
+    return a.boards_ == b.boards_;
+}
+
+/// @brief Squares attacked by all pieces of given kind of given side, computed set-wise where possible.
+inline Bitboard ComputeAttacks(const Position& position, const std::size_t side, const std::size_t piece_kind)
+{
+    const Bitboard pieces = position[side + piece_kind];
+    if (!pieces)
+    {
+        return 0;
+    }
+    const Bitboard occupied_squares = position[kOccupiedBoard];
+    switch (piece_kind)
+    {
+        case kPawn:
+            return (side == kWhiteBoard) ? (SingleStep(pieces, kNorthWest) | SingleStep(pieces, kNorthEast))
+                                         : (SingleStep(pieces, kSouthWest) | SingleStep(pieces, kSouthEast));
+        case kKnight: {
+            Bitboard attacks{0};
+            for (Bitboard knights = pieces; knights; knights &= knights - 1)
+            {
+                attacks |= kKnightJumps[tzcnt(knights)];
+            }
+            return attacks;
+        }
+        case kBishop:
+            return SlidingAttacks(Bitboard{0}, pieces, occupied_squares);
+        case kRook:
+            return SlidingAttacks(pieces, Bitboard{0}, occupied_squares);
+        case kQueen:
+            return SlidingAttacks(pieces, pieces, occupied_squares);
+        default:  // kKing
+            return kKingAttacks[tzcnt(pieces)];
+    }
+}
+
+/// @brief Computes the attack maps of given position from scratch.
+inline AttackMaps ComputeAttackMaps(const Position& position)
+{
+    AttackMaps attack_maps{};
+    for (const std::size_t side : {kBlackBoard, kWhiteBoard})
+    {
+        Bitboard all_attacks{0};
+        for (std::size_t piece_kind = kPawn; piece_kind <= kKing; piece_kind++)
+        {
+            attack_maps.boards_[side + piece_kind] = ComputeAttacks(position, side, piece_kind);
+            all_attacks |= attack_maps.boards_[side + piece_kind];
+        }
+        attack_maps.boards_[side] = all_attacks;
+    }
+    return attack_maps;
+}
+
+/// @brief Derives the attack maps after given move from the attack maps before it.
+///
+/// Only the kinds of pieces touched by the move are recomputed, plus sliders whose attacks reach a square the move
+/// vacated or occupied (their rays are the only ones which change). Everything else is taken over.
+///
+/// @param position The position after the move.
+inline AttackMaps UpdateAttackMaps(const AttackMaps& attack_maps_before_move,
+                                   const Position& position,
+                                   const Bitmove move)
+{
+    const std::size_t moving_side = position.GetDefendingSide();
+    const std::size_t opposing_side = position.GetAttackingSide();
+    const Bitboard target = Bitboard{1} << ExtractTarget(move);
+
+    Bitboard changed_squares = (Bitboard{1} << ExtractSource(move)) | target;
+    std::uint32_t outdated_boards = std::uint32_t{1} << (moving_side + ExtractMovedPiece(move));
+    if (ExtractCapturedPiece(move))
+    {
+        outdated_boards |= std::uint32_t{1} << (opposing_side + ExtractCapturedPiece(move));
+    }
+    switch (move & kMoveMaskType)
+    {
+        case kMoveTypeEnPassantCapture:
+            changed_squares |= SingleStep(target, (moving_side == kWhiteBoard) ? kSouth : kNorth);
+            break;
+        case kMoveTypeKingsideCastling:
+            changed_squares |= (target >> 1) | (target << 1);  // rook from corner to next to the king
+            outdated_boards |= std::uint32_t{1} << (moving_side + kRook);
+            break;
+        case kMoveTypeQueensideCastling:
+            changed_squares |= (target << 2) | (target >> 1);
+            outdated_boards |= std::uint32_t{1} << (moving_side + kRook);
+            break;
+        case kMoveTypePromotion:
+            outdated_boards |= std::uint32_t{1} << (moving_side + ExtractPromotion(move));
+            break;
+    }
+
+    AttackMaps attack_maps{attack_maps_before_move};
+    for (const std::size_t side : {kBlackBoard, kWhiteBoard})
+    {
+        for (const std::size_t slider : {kBishop, kRook, kQueen})
+        {
+            if (attack_maps_before_move[side + slider] & changed_squares)
+            {
+                outdated_boards |= std::uint32_t{1} << (side + slider);
+            }
+        }
+        Bitboard all_attacks{0};
+        for (std::size_t piece_kind = kPawn; piece_kind <= kKing; piece_kind++)
+        {
+            if (outdated_boards & (std::uint32_t{1} << (side + piece_kind)))
+            {
+                attack_maps.boards_[side + piece_kind] = ComputeAttacks(position, side, piece_kind);
+            }
+            all_attacks |= attack_maps.boards_[side + piece_kind];
+        }
+        attack_maps.boards_[side] = all_attacks;
+    }
+    return attack_maps;
+}
+
+/// @brief Whether the king of given side is attacked, looked up rather than searched for (see
+/// Position::IsKingInCheck).
+inline bool IsKingAttacked(const Position& position, const AttackMaps& attack_maps, const std::size_t side)
+{
+    return position[side + kKing] & attack_maps[side ^ kToggleSide];
+}
+
+/// Attack maps of every node are computed from scratch.
+struct RecomputeAttackMaps
+{
+    static constexpr bool incremental = false;
+};
+
+/// Attack maps of a child are derived from the ones of its parent (see UpdateAttackMaps).
+struct UpdateAttackMapsIncrementally
+{
+    static constexpr bool incremental = true;
+};
+
+/// @brief Attack maps of the child reached by given move, given the attack maps of its parent.
+template <typename AttackMapsBehavior>
+AttackMaps ComputeAttackMapsOfChild(const AttackMaps& parent_attack_maps,
+                                    const Position& child_position,
+                                    const Bitmove move)
+{
+    if constexpr (AttackMapsBehavior::incremental)
+    {
+        return UpdateAttackMaps(parent_attack_maps, child_position, move);
+    }
+    else
+    {
+        std::ignore = parent_attack_maps;
+        std::ignore = move;  // Resolve warning if recomputed.
+        return ComputeAttackMaps(child_position);
+    }
+}
+
+}  // namespace Chess
+
+#endif
@@ -8,7 +8,7 @@ namespace Chess
 
 using Bitmove = uint32_t;
 using Bitboard = uint64_t;
-using Evaluation = float;
+using Evaluation = int16_t;  // in centipawns
 
 }  // namespace Chess
 
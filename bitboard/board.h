@@ -11,18 +11,19 @@ namespace Chess
 
 constexpr std::size_t kExtrasBoard = 0;
 constexpr std::size_t kBlackBoard = 1;
+constexpr std::size_t kOccupiedBoard = 8;  // squares occupied by either side
 constexpr std::size_t kWhiteBoard = 9;
-constexpr std::size_t kUnused1Board = 8;
-constexpr std::size_t kUnused2Board = 16;
+constexpr std::size_t kNumberOfBoards = 16;
 constexpr std::size_t kToggleSide = kWhiteBoard - kBlackBoard;
 
 // clang-format off
-constexpr Bitboard kBoardMaskStaticPlies =                 0b00000000'00000000'00000000'00000000'00000000'00000000'00111111'00000000;
+constexpr Bitboard kBoardMaskStaticPlies =                 0b00000000'11111111'00000000'00000000'00000000'00000000'00000000'00000000;
 constexpr Bitboard kBoardMaskEnPassant =                   0b00000000'00000000'11111111'00000000'00000000'11111111'00000000'00000000;
 constexpr Bitboard kBoardMaskTotalPlies =                  0b00000000'00000000'00000000'11111111'11111111'00000000'00000000'00000000;
-constexpr Bitboard kBoardMaskUnused =                      0b01110110'11111111'00000000'00000000'00000000'00000000'00000000'01110110;
+constexpr Bitboard kBoardMaskUnused =                      0b01110110'00000000'00000000'00000000'00000000'00000000'00111111'01110100;
+constexpr Bitboard kBoardMaskBlackToMove =                 0b00000000'00000000'00000000'00000000'00000000'00000000'00000000'00000010;
 
-constexpr Bitboard kIncrementStaticPlies =                 0b00000000'00000000'00000000'00000000'00000000'00000000'00000001'00000000;
+constexpr Bitboard kIncrementStaticPlies =                 0b00000000'00000001'00000000'00000000'00000000'00000000'00000000'00000000;
 constexpr Bitboard kIncrementTotalPlies =                  0b00000000'00000000'00000000'00000000'00000001'00000000'00000000'00000000;
 
 // castling occured on last move, regardless of side
@@ -38,7 +39,7 @@ constexpr Bitboard kCastlingBlackKingside = H8 | E8;
 constexpr Bitboard kCastlingBlackQueenside = A8 | E8;
 constexpr Bitboard kCastlingStillPossible = E1 | E8;
 
-constexpr int kBoardShiftStaticPlies = 8;
+constexpr int kBoardShiftStaticPlies = 48;
 constexpr int kBoardShiftTotalPlies = 24;
 
 }  // namespace Chess
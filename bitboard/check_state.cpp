@@ -0,0 +1,134 @@
+#include "bitboard/check_state.h"
+
+#include "bitboard/lookup_table/knight.h"
+#include "bitboard/lookup_table/pawn.h"
+#include "bitboard/lookup_table/piece.h"
+#include "bitboard/pieces.h"
+#include "bitboard/shift.h"
+#include "bitboard/sliding_attacks.h"
+#include "hardware/trailing_zeros_count.h"
+
+#include <algorithm>
+
+namespace Chess
+{
+
+namespace
+{
+
+/// @brief Squares strictly between the given squares, assuming both share a line.
+Bitboard SquaresInBetween(const Bitmove first_square_bit, const Bitmove second_square_bit)
+{
+    // along every line the bit index grows monotonously, so the line is cut down to the range of indices in between
+    const Bitmove lower_bit = std::min(first_square_bit, second_square_bit);
+    const Bitmove upper_bit = std::max(first_square_bit, second_square_bit);
+    const Bitboard range_in_between = ((Bitboard{1} << upper_bit) - 1) & ~((Bitboard{2} << lower_bit) - 1);
+    return SquaresOnLineThrough(first_square_bit, second_square_bit) & range_in_between;
+}
+
+}  // namespace
+
+CheckState ComputeCheckState(const Position& position)
+{
+    CheckState check_state{};
+    const std::size_t own_side = position.GetAttackingSide();
+    const std::size_t opposing_side = position.GetDefendingSide();
+    const Bitboard king = position[own_side + kKing];
+    if (!king)
+    {
+        return check_state;  // only in artificial positions
+    }
+    const Bitmove king_bit = tzcnt(king);
+    const Bitboard occupied_squares = position[kOccupiedBoard];
+    const Bitboard opposing_queens = position[opposing_side + kQueen];
+    const Bitboard opposing_rook_sliders = position[opposing_side + kRook] | opposing_queens;
+    const Bitboard opposing_bishop_sliders = position[opposing_side + kBishop] | opposing_queens;
+
+    // sliders on a line with the king, no matter what is in between: none in between gives check, a single own piece
+    // in between is pinned
+    const Bitboard sliders_on_line_with_king =
+        (kRookAttacks[king_bit] & opposing_rook_sliders) | (kBishopAttacks[king_bit] & opposing_bishop_sliders);
+    for (Bitboard sliders = sliders_on_line_with_king; sliders; sliders &= sliders - 1)
+    {
+        const Bitmove slider_bit = tzcnt(sliders);
+        const Bitboard squares_in_between = SquaresInBetween(king_bit, slider_bit);
+        const Bitboard pieces_in_between = squares_in_between & occupied_squares;
+        if (!pieces_in_between)
+        {
+            check_state.checkers |= Bitboard{1} << slider_bit;
+            check_state.check_evasion_squares |= squares_in_between | (Bitboard{1} << slider_bit);
+        }
+        else if (!(pieces_in_between & (pieces_in_between - 1)) && (pieces_in_between & position[own_side]))
+        {
+            check_state.pinned_pieces |= pieces_in_between;
+        }
+    }
+
+    // jumpers
+    const std::size_t pawn_attacks_offset = (opposing_side == kWhiteBoard) * kPawnAttacksLookupTableOffsetForWhite;
+    const Bitboard jumping_checkers = (kKnightJumps[king_bit] & position[opposing_side + kKnight]) |
+                                      (kPawnAttacks[king_bit + pawn_attacks_offset] & position[opposing_side + kPawn]);
+    check_state.checkers |= jumping_checkers;
+    check_state.check_evasion_squares |= jumping_checkers;
+
+    // king danger squares (the own king doesn't block sliders)
+    check_state.king_danger_squares =
+        SlidingAttacks(opposing_rook_sliders, opposing_bishop_sliders, occupied_squares & ~king);
+    const Bitboard opposing_pawns = position[opposing_side + kPawn];
+    const bool opposing_pawns_move_north = opposing_side == kWhiteBoard;
+    check_state.king_danger_squares |= SingleStep(opposing_pawns, opposing_pawns_move_north ? kNorthWest : kSouthWest) |
+                                       SingleStep(opposing_pawns, opposing_pawns_move_north ? kNorthEast : kSouthEast);
+    for (Bitboard knights = position[opposing_side + kKnight]; knights; knights &= knights - 1)
+    {
+        check_state.king_danger_squares |= kKnightJumps[tzcnt(knights)];
+    }
+    const Bitboard opposing_king = position[opposing_side + kKing];
+    if (opposing_king)
+    {
+        check_state.king_danger_squares |= kKingAttacks[tzcnt(opposing_king)];
+    }
+
+    return check_state;
+}
+
+bool IsLegal(const Position& position, const CheckState& check_state, const Bitmove move)
+{
+    const Bitboard source = Bitboard{1} << ExtractSource(move);
+    const Bitboard target = Bitboard{1} << ExtractTarget(move);
+    const Bitboard king = position[position.GetAttackingSide() + kKing];
+    const Bitmove move_type = move & kMoveMaskType;
+
+    if (source & king)
+    {
+        if ((move_type == kMoveTypeKingsideCastling) || (move_type == kMoveTypeQueensideCastling))
+        {
+            const Bitboard pass_through_square = move_type == kMoveTypeKingsideCastling ? king >> 1 : king << 1;
+            return !check_state.IsInCheck() && !(check_state.king_danger_squares & (pass_through_square | target));
+        }
+        return !(check_state.king_danger_squares & target);
+    }
+
+    if (move_type == kMoveTypeEnPassantCapture)
+    {
+        Position position_after_move{position};
+        position_after_move.MakeMove(move);
+        return !position_after_move.IsKingInCheck(position_after_move.GetDefendingSide());
+    }
+
+    const bool is_double_check = check_state.checkers & (check_state.checkers - 1);
+    if (is_double_check)
+    {
+        return false;
+    }
+    if (check_state.IsInCheck() && !(check_state.check_evasion_squares & target))
+    {
+        return false;
+    }
+    if (source & check_state.pinned_pieces)
+    {
+        return SquaresOnLineThrough(tzcnt(king), ExtractSource(move)) & target;
+    }
+    return true;
+}
+
+}  // namespace Chess
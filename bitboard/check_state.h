@@ -0,0 +1,61 @@
+#ifndef BITBOARD_CHECK_STATE_H
+#define BITBOARD_CHECK_STATE_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/lookup_table/piece.h"
+#include "bitboard/position.h"
+
+namespace Chess
+{
+
+/// @brief Safety of the king of the side to move, computed once per node.
+///
+/// Replaces making every move just to test afterwards whether it left the own king in check.
+struct CheckState
+{
+    /// Opposing pieces giving check.
+    Bitboard checkers{0};
+
+    /// Own pieces standing alone between the own king and an opposing slider, i.e. pieces which can't leave that line.
+    Bitboard pinned_pieces{0};
+
+    /// Squares attacked by the opponent, seen as if the own king was not on the board (it can't step back along a ray).
+    Bitboard king_danger_squares{0};
+
+    /// Squares where a piece other than the king ends a single check: the checker and the squares in between.
+    Bitboard check_evasion_squares{0};
+
+    bool IsInCheck() const { return checkers; }
+};
+
+/// @brief Squares on the line through both given squares, without these two (none if they share no line).
+///
+/// Looked up as the intersection of the rook (or bishop) attacks of both squares: lines of the same kind through two
+/// different squares are either the same or parallel, except for the line through both.
+inline Bitboard SquaresOnLineThrough(const Bitmove first_square_bit, const Bitmove second_square_bit)
+{
+    const Bitboard second_square = Bitboard{1} << second_square_bit;
+    if (kRookAttacks[first_square_bit] & second_square)
+    {
+        return kRookAttacks[first_square_bit] & kRookAttacks[second_square_bit];
+    }
+    if (kBishopAttacks[first_square_bit] & second_square)
+    {
+        return kBishopAttacks[first_square_bit] & kBishopAttacks[second_square_bit];
+    }
+    return 0;
+}
+
+/// @brief Checkers and pinned pieces from the sliders on a line with the own king (see SquaresOnLineThrough), the
+/// king danger squares from the set-wise SlidingAttacks.
+CheckState ComputeCheckState(const Position& position);
+
+/// @brief Whether the given pseudo legal move of the side to move keeps its king out of check.
+///
+/// En passant captures, which may uncover a check along the rank of both pawns, are rare enough to be played on a
+/// copy of the position instead.
+bool IsLegal(const Position& position, const CheckState& check_state, const Bitmove move);
+
+}  // namespace Chess
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef BITBOARD_COMPACT_MOVE_H
+#define BITBOARD_COMPACT_MOVE_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/move.h"
+#include "bitboard/pieces.h"
+#include "bitboard/position.h"
+
+#include <cstdint>
+
+namespace Chess
+{
+
+/// @brief Move of only 16 bits for storage (e.g. hash table, killer moves, history keys or opening book).
+///
+/// Holds source, target and four bits of flags. Moved and captured piece are left out, they are read from the position
+/// the move is played in (see ToBitmove).
+using CompactMove = std::uint16_t;
+
+constexpr CompactMove kCompactNullMove = 0;
+
+// clang-format off
+constexpr CompactMove kCompactMoveMaskSource =            0b0000'000000'111111;
+constexpr CompactMove kCompactMoveMaskTarget =            0b0000'111111'000000;
+constexpr CompactMove kCompactMoveMaskFlags =             0b1111'000000'000000;
+
+constexpr CompactMove kCompactMoveFlagQuiet =             0b0000;  // including single pawn pushes
+constexpr CompactMove kCompactMoveFlagDoublePush =        0b0001;
+constexpr CompactMove kCompactMoveFlagKingsideCastling =  0b0010;
+constexpr CompactMove kCompactMoveFlagQueensideCastling = 0b0011;
+constexpr CompactMove kCompactMoveFlagCapture =           0b0100;
+constexpr CompactMove kCompactMoveFlagEnPassantCapture =  0b0101;
+constexpr CompactMove kCompactMoveFlagPromotion =         0b1000;  // plus capture flag and promoted piece - knight
+constexpr CompactMove kCompactMoveMaskPromotion =         0b0011;
+// clang-format on
+
+constexpr int kCompactMoveShiftTarget = 6;
+constexpr int kCompactMoveShiftFlags = 12;
+
+/// @brief Drops moved and captured piece of a move, which is otherwise kept as is.
+constexpr inline CompactMove ToCompactMove(const Bitmove move)
+{
+    const auto source_and_target = static_cast<CompactMove>(move & (kMoveMaskSource | kMoveMaskTarget));
+    CompactMove flags{kCompactMoveFlagQuiet};
+    switch (move & kMoveMaskType)
+    {
+        case kMoveTypePawnDoublePush:
+            flags = kCompactMoveFlagDoublePush;
+            break;
+        case kMoveTypeKingsideCastling:
+            flags = kCompactMoveFlagKingsideCastling;
+            break;
+        case kMoveTypeQueensideCastling:
+            flags = kCompactMoveFlagQueensideCastling;
+            break;
+        case kMoveTypeCapture:
+            flags = kCompactMoveFlagCapture;
+            break;
+        case kMoveTypeEnPassantCapture:
+            flags = kCompactMoveFlagEnPassantCapture;
+            break;
+        case kMoveTypePromotion:
+            flags = kCompactMoveFlagPromotion |
+                    static_cast<CompactMove>((move & kMoveMaskCapturedPiece) ? kCompactMoveFlagCapture : 0) |
+                    static_cast<CompactMove>(((move & kMoveMaskPromotion) >> kMoveShiftPromotion) - kKnight);
+            break;
+    }
+    return static_cast<CompactMove>(source_and_target | (flags << kCompactMoveShiftFlags));
+}
+
+/// @brief Restores the complete move from a compact one, reading moved and captured piece from the position the move
+/// is about to be played in.
+///
+/// The compact move is expected to be pseudo-legal in the position (see IsPseudoLegal after converting it), e.g. a
+/// killer move from another position may leave a square without piece.
+inline Bitmove ToBitmove(const Position& position, const CompactMove compact_move)
+{
+    if (compact_move == kCompactNullMove)
+    {
+        return kBitNullMove;
+    }
+    const Bitmove source = compact_move & kCompactMoveMaskSource;
+    const Bitmove target = (compact_move & kCompactMoveMaskTarget) >> kCompactMoveShiftTarget;
+    const CompactMove flags = compact_move >> kCompactMoveShiftFlags;
+    const Bitmove moved_piece = position.GetPieceKind(position.GetAttackingSide(), Bitboard{1} << source);
+    const auto captured_piece = [&]() {
+        return position.GetPieceKind(position.GetDefendingSide(), Bitboard{1} << target);
+    };
+
+    if (flags & kCompactMoveFlagPromotion)
+    {
+        const Bitmove promotion = kKnight + (flags & kCompactMoveMaskPromotion);
+        const Bitmove promotion_capture = (flags & kCompactMoveFlagCapture) ? captured_piece() : kNoCapture;
+        return ComposeMove(source, target, kPawn, promotion_capture, promotion, kMoveTypePromotion);
+    }
+    switch (flags)
+    {
+        case kCompactMoveFlagDoublePush:
+            return ComposeMove(source, target, kPawn, kNoCapture, kNoPromotion, kMoveTypePawnDoublePush);
+        case kCompactMoveFlagKingsideCastling:
+            return ComposeMove(source, target, kKing, kNoCapture, kNoPromotion, kMoveTypeKingsideCastling);
+        case kCompactMoveFlagQueensideCastling:
+            return ComposeMove(source, target, kKing, kNoCapture, kNoPromotion, kMoveTypeQueensideCastling);
+        case kCompactMoveFlagCapture:
+            return ComposeMove(source, target, moved_piece, captured_piece(), kNoPromotion, kMoveTypeCapture);
+        case kCompactMoveFlagEnPassantCapture:
+            return ComposeMove(source, target, kPawn, kPawn, kNoPromotion, kMoveTypeEnPassantCapture);
+        default: {
+            const Bitmove move_type = (moved_piece == kPawn) ? kMoveTypePawnSinglePush : kMoveTypeQuietNonPawn;
+            return ComposeMove(source, target, moved_piece, kNoCapture, kNoPromotion, move_type);
+        }
+    }
+}
+
+/// @brief Element of move lists to be ordered, i.e. a move with its score (e.g. from material gain or history).
+struct ScoredMove
+{
+    Bitmove move{kBitNullMove};
+    Evaluation score{0};
+};
+
+/// @brief For sorting scored moves best first.
+inline bool IsScoreGreater(const ScoredMove& a, const ScoredMove& b)
+{
+    return a.score > b.score;
+}
+
+}  // namespace Chess
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef BITBOARD_COPY_MAKE_H
+#define BITBOARD_COPY_MAKE_H
+
+#include "bitboard/move.h"
+#include "bitboard/position.h"
+
+#include <array>
+#include <tuple>
+
+namespace Chess
+{
+
+/// Children are searched on the parent's position, which is updated by the move and taken back afterwards.
+struct MakeAndUnmakeMoves
+{
+    static constexpr bool copy_make = false;
+};
+
+/// Children are searched on a copy of the parent's position, which is updated by the move and simply left behind.
+/// Nothing is taken back, at the price of copying the position for every move.
+struct CopyAndMakeMoves
+{
+    static constexpr bool copy_make = true;
+};
+
+/// @brief Type to preallocate one position per ply of the searched path (root plus up to 128 plies).
+using PositionStack = std::array<Position, 129>;
+
+/// @brief The position stack of the calling thread, as every thread searches its own path.
+inline PositionStack& GetPositionStack()
+{
+    thread_local PositionStack position_stack{};
+    return position_stack;
+}
+
+/// @brief Plays move and returns the position of the child at given ply (from the root) together with the extras
+/// needed to take it back (see Position::MakeMove).
+///
+/// Make/unmake updates the given position itself, copy-make the slot of the child on the position stack.
+template <typename MakeBehavior>
+Position& MakeMoveForChild(Position& position, const Bitmove move, const std::size_t child_ply, Bitboard& saved_extras)
+{
+    if constexpr (MakeBehavior::copy_make)
+    {
+        Position& child_position = GetPositionStack()[child_ply];
+        child_position = position;
+        saved_extras = child_position.MakeMove(move);
+        return child_position;
+    }
+    else
+    {
+        std::ignore = child_ply;
+        saved_extras = position.MakeMove(move);
+        return position;
+    }
+}
+
+/// @brief Returns to the parent after its child was searched. (Nothing to do for copy-make.)
+template <typename MakeBehavior>
+void UnmakeMoveForChild(Position& position, const Bitmove move, const Bitboard saved_extras)
+{
+    if constexpr (!MakeBehavior::copy_make)
+    {
+        position.UnmakeMove(move, saved_extras);
+    }
+    std::ignore = position;
+    std::ignore = move;
+    std::ignore = saved_extras;  // Resolve warning if copy-make.
+}
+
+}  // namespace Chess
+
+#endif
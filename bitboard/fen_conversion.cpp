@@ -111,18 +111,16 @@ Position PositionFromFen(const std::string& fen)
         }
     }
 
+    position.UpdateOccupiedSquares();
+
     const char side_to_move = tokens.at(kFenTokenSide).front();
     switch (side_to_move)
     {
         case 'w':
-            position.white_to_move_ = true;
-            position.attacking_side_ = kWhiteBoard;
-            position.defending_side_ = kBlackBoard;
+            position.SetWhiteToMove(true);
             break;
         case 'b':
-            position.white_to_move_ = false;
-            position.attacking_side_ = kBlackBoard;
-            position.defending_side_ = kWhiteBoard;
+            position.SetWhiteToMove(false);
             break;
         default:
             throw std::runtime_error{"FEN contains invalid token for side to play."};
@@ -226,7 +224,7 @@ std::string FenFromPosition(const Position& position)
         }
     }
 
-    const auto side = position.white_to_move_ ? "w" : "b";
+    const auto side = position.IsWhiteToMove() ? "w" : "b";
 
     std::string castling{};
     if (position[kExtrasBoard] & kCastlingWhiteKingside)
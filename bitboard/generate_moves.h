@@ -1,17 +1,21 @@
 #ifndef BITBOARD_GENERATE_MOVES_H
 #define BITBOARD_GENERATE_MOVES_H
 
+#include "bitboard/check_state.h"
 #include "bitboard/lookup_table/knight.h"
 #include "bitboard/lookup_table/pawn.h"
 #include "bitboard/lookup_table/piece.h"
 #include "bitboard/move_stack.h"
 #include "bitboard/position.h"
 #include "bitboard/shift.h"
+#include "bitboard/sliding_attacks.h"
 #include "bitboard/squares.h"
 #include "hardware/trailing_zeros_count.h"
 
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <tuple>
 #include <type_traits>
 
 namespace Chess
@@ -19,22 +23,87 @@ namespace Chess
 
 /// @brief Type to configure behavior of GenerateMoves at compile time
 ///
-/// This class is substituted for a mock in tests.
+/// Generates all pseudo legal moves, or all legal moves if GenerateMoves is given the CheckState of the position. This
+/// class is substituted for a mock in tests.
 struct GenerateAllPseudoLegalMoves
 {
     static constexpr bool generate_all_legal_moves{true};
+    static constexpr bool use_kogge_stone_sliders{false};
 };
 
-/// @brief Generates all pseudo legal moves from given position
+/// @brief Like GenerateAllPseudoLegalMoves, but with slider targets from Kogge-Stone fills (see SlidingAttacks).
+struct GenerateAllPseudoLegalMovesWithKoggeStoneSliders
+{
+    static constexpr bool generate_all_legal_moves{true};
+    static constexpr bool use_kogge_stone_sliders{true};
+};
+
+/// @brief Generates only quiet moves which give check, e.g. for the first ply of a quiescence search.
 ///
-/// "Pseudo" in the sense that the king may be in check after generated move.
+/// Quiet in the sense of neither capture nor promotion. Check is given either directly by the moved piece or by
+/// discovery, i.e. the moved piece uncovers a slider.
+struct GenerateQuietChecks
+{
+    static constexpr bool generate_quiet_checks{true};
+};
+
+/// @brief Generates the castling moves of given position, as far as castling rights and free squares allow.
+///
+/// Whether the king passes attacked squares is left to the legality check.
 ///
 /// @returns An iterator pointing to the element past the last generated move
-template <typename Behavior = GenerateAllPseudoLegalMoves>
-std::enable_if_t<Behavior::generate_all_legal_moves, MoveStack::iterator> GenerateMoves(
-    const Position& position,
-    MoveStack::iterator move_generation_insertion_iterator)
+inline MoveStack::iterator GenerateCastlingMoves(const Position& position,
+                                                 MoveStack::iterator move_generation_insertion_iterator)
 {
+    constexpr std::array<Bitboard, 4> castling_rights{
+        kCastlingBlackKingside, kCastlingBlackQueenside, kCastlingWhiteKingside, kCastlingWhiteQueenside};
+    constexpr std::array<Bitboard, 4> neccessary_free_squares = {F8 | G8, D8 | C8 | B8, F1 | G1, D1 | C1 | B1};
+    constexpr Bitmove black_king_source_bits = 59;
+    constexpr Bitmove white_king_source_bits = 3;
+    constexpr std::array<int, 4> target_bits{57, 61, 1, 5};
+    constexpr Bitmove black_kingside = ComposeMove(
+        black_king_source_bits, std::get<0>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeKingsideCastling);
+    constexpr Bitmove black_queenside = ComposeMove(
+        black_king_source_bits, std::get<1>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeQueensideCastling);
+    constexpr Bitmove white_kingside = ComposeMove(
+        white_king_source_bits, std::get<2>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeKingsideCastling);
+    constexpr Bitmove white_queenside = ComposeMove(
+        white_king_source_bits, std::get<3>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeQueensideCastling);
+    constexpr std::array<Bitmove, 4> castling_moves{black_kingside, black_queenside, white_kingside, white_queenside};
+
+    const Bitboard free_squares = ~position[kOccupiedBoard];
+    const std::size_t offset_for_white = 2 * position.IsWhiteToMove();
+    for (const std::size_t side : {0, 1})  // side as in queen- or kingside, not white or black
+    {
+        const std::size_t castling = side + offset_for_white;
+        const bool castling_to_side_is_allowed =
+            (position[kExtrasBoard] & castling_rights[castling]) == castling_rights[castling];
+        const bool space_between_king_and_rook_is_free =
+            (free_squares & neccessary_free_squares[castling]) == neccessary_free_squares[castling];
+        const bool castling_possible = castling_to_side_is_allowed && space_between_king_and_rook_is_free;
+        if (castling_possible)
+        {
+            *move_generation_insertion_iterator++ = castling_moves[castling];
+        }
+    }
+    return move_generation_insertion_iterator;
+}
+
+/// @brief Generates all moves from given position, either pseudo legal ones or only the legal ones
+///
+/// Legal moves are pseudo legal moves restricted by check_state: In check, pieces other than the king may only capture
+/// the checker or block its line (and nothing in double check), pinned pieces may only move along the line of their
+/// pin and the king may only step onto squares not attacked. Castling out of or through check and en passant
+/// captures which uncover a slider are left out as well.
+///
+/// @returns An iterator pointing to the element past the last generated move
+template <typename Behavior, bool only_legal_moves>
+MoveStack::iterator GenerateAllMoves(const Position& position,
+                                     const CheckState& check_state,
+                                     MoveStack::iterator move_generation_insertion_iterator)
+{
+    const MoveStack::iterator begin_of_move_list = move_generation_insertion_iterator;
+
     /// @brief A function to loop over individual bits (the population) of a Bitboard
     const auto ForEveryBitInPopulation =
         [](const Bitboard population,
@@ -69,233 +138,470 @@ std::enable_if_t<Behavior::generate_all_legal_moves, MoveStack::iterator> Genera
             ComposeMove(source, target, kPawn, captured_piece, kBishop, kMoveTypePromotion);
     };
 
-    const bool& white_to_move = position.white_to_move_;
-    const std::size_t& attacking_side = position.attacking_side_;
-    const std::size_t& defending_side = position.defending_side_;
-    const Bitboard free_squares = ~(position[kBlackBoard] | position[kWhiteBoard]);
-
-    // pawn moves
-    const auto generate_pawn_move = [&](const Bitmove source_bit, const Bitboard source) {
-        const std::array<Bitboard, 2>& pawn_capture_targets =
-            kPawnCaptureLookupTable[source_bit + kPawnCapturesLookupTableOffsetForBlack * !white_to_move];
-        const std::array<Bitboard, 2> pawn_capture_target_bits{tzcnt(std::get<0>(pawn_capture_targets)),
-                                                               tzcnt(std::get<1>(pawn_capture_targets))};
-        const Bitboard target_single_push = white_to_move ? source << 8 : source >> 8;
-
-        // captures
-        for (const std::size_t index : {0, 1})
+    const bool white_to_move = position.IsWhiteToMove();
+    const std::size_t attacking_side = position.GetAttackingSide();
+    const std::size_t defending_side = position.GetDefendingSide();
+    const Bitboard free_squares = ~position[kOccupiedBoard];
+    const Bitboard king_board = position[attacking_side + kKing];
+    const Bitmove king_bit = tzcnt(king_board);
+
+    // restrictions of legal moves (none for pseudo legal moves)
+    Bitboard targets_of_pieces_other_than_king{~Bitboard{0}};
+    Bitboard targets_of_king{~Bitboard{0}};
+    Bitboard pinned_pieces{0};
+    if constexpr (only_legal_moves)
+    {
+        const bool is_double_check = check_state.checkers & (check_state.checkers - 1);
+        if (is_double_check)
         {
-            if (position[defending_side] & pawn_capture_targets[index])
-            {
-                const Bitmove captured_piece = position.GetPieceKind(defending_side, pawn_capture_targets[index]);
-                const bool is_promotion = pawn_capture_targets[index] & kPromotionRanks;
-                if (!is_promotion)
-                {
-                    *move_generation_insertion_iterator++ = ComposeMove(source_bit,
-                                                                        pawn_capture_target_bits[index],
-                                                                        kPawn,
-                                                                        captured_piece,
-                                                                        kNoPromotion,
-                                                                        kMoveTypeCapture);
-                }
-                else
-                {
-                    // promotion (with capture)
-                    PushBackAllPromotions(move_generation_insertion_iterator,
-                                          source_bit,
-                                          pawn_capture_target_bits[index],
-                                          captured_piece);
-                }
-            }
+            targets_of_pieces_other_than_king = 0;
         }
+        else if (check_state.IsInCheck())
+        {
+            targets_of_pieces_other_than_king = check_state.check_evasion_squares;
+        }
+        targets_of_king = ~check_state.king_danger_squares;
+        pinned_pieces = check_state.pinned_pieces;
+    }
+    const auto restrict_pin = [pinned_pieces, king_bit](const Bitmove source_bit, const Bitboard targets) {
+        return ((Bitboard{1} << source_bit) & pinned_pieces) ? targets & SquaresOnLineThrough(king_bit, source_bit)
+                                                              : targets;
+    };
+    const auto stays_on_pin_line = [&restrict_pin](const Bitmove source_bit, const Bitmove target_bit) {
+        return static_cast<bool>(restrict_pin(source_bit, Bitboard{1} << target_bit));
+    };
 
-        // en passant
-        const Bitboard en_passant_square = position[kExtrasBoard] & kBoardMaskEnPassant;
-        if (en_passant_square)
+    // pawn moves (set-wise: all pawns are shifted at once, then the targets are serialised)
+    const Bitboard pawns = position[attacking_side + kPawn];
+    const std::size_t forward = white_to_move ? kNorth : kSouth;
+    const int forward_bits = kStepBits[forward];
+    const Bitboard target_single_pushes = SingleStep(pawns, forward) & free_squares;
+    const Bitboard target_double_pushes =
+        SingleStep(target_single_pushes & (white_to_move ? kRank3 : kRank6), forward) & free_squares;
+    const Bitboard allowed_single_pushes = target_single_pushes & targets_of_pieces_other_than_king;
+    for (Bitboard targets = allowed_single_pushes & ~kPromotionRanks; targets; targets &= targets - 1)
+    {
+        const Bitmove target_bit = tzcnt(targets);
+        if (stays_on_pin_line(target_bit - forward_bits, target_bit))
         {
-            for (const std::size_t index : {0, 1})
-            {
-                if (en_passant_square == pawn_capture_targets[index])
-                {
-                    *move_generation_insertion_iterator++ = ComposeMove(source_bit,
-                                                                        pawn_capture_target_bits[index],
-                                                                        kPawn,
-                                                                        kPawn,
-                                                                        kNoPromotion,
-                                                                        kMoveTypeEnPassantCapture);
-                }
-            }
+            *move_generation_insertion_iterator++ = ComposeMove(
+                target_bit - forward_bits, target_bit, kPawn, kNoCapture, kNoPromotion, kMoveTypePawnSinglePush);
+        }
+    }
+    for (Bitboard targets = allowed_single_pushes & kPromotionRanks; targets; targets &= targets - 1)
+    {
+        const Bitmove target_bit = tzcnt(targets);
+        if (stays_on_pin_line(target_bit - forward_bits, target_bit))
+        {
+            PushBackAllPromotions(
+                move_generation_insertion_iterator, target_bit - forward_bits, target_bit, kNoCapture);
+        }
+    }
+    for (Bitboard targets = target_double_pushes & targets_of_pieces_other_than_king; targets; targets &= targets - 1)
+    {
+        const Bitmove target_bit = tzcnt(targets);
+        if (stays_on_pin_line(target_bit - 2 * forward_bits, target_bit))
+        {
+            *move_generation_insertion_iterator++ = ComposeMove(
+                target_bit - 2 * forward_bits, target_bit, kPawn, kNoCapture, kNoPromotion, kMoveTypePawnDoublePush);
         }
+    }
+
+    /// @brief Whether an en passant capture keeps the own king safe. Both pawns leave their squares, which may
+    /// uncover a slider even along the rank of both pawns, so the sliders are looked up in the position after it.
+    const auto is_en_passant_legal = [&](const Bitmove source_bit, const Bitmove target_bit) {
+        if constexpr (only_legal_moves)
+        {
+            const Bitboard captured_pawn = Bitboard{1} << (target_bit - forward_bits);
+            const Bitboard occupied_squares_after_capture =
+                (~free_squares & ~((Bitboard{1} << source_bit) | captured_pawn)) | (Bitboard{1} << target_bit);
+            const Bitboard opposing_queens = position[defending_side + kQueen];
+            const Bitboard remaining_jumping_checkers =
+                check_state.checkers & (position[defending_side + kKnight] | position[defending_side + kPawn]) &
+                ~captured_pawn;
+            return !remaining_jumping_checkers &&
+                   !(SlidingAttacks(king_board, Bitboard{0}, occupied_squares_after_capture) &
+                     (position[defending_side + kRook] | opposing_queens)) &&
+                   !(SlidingAttacks(Bitboard{0}, king_board, occupied_squares_after_capture) &
+                     (position[defending_side + kBishop] | opposing_queens));
+        }
+        else
+        {
+            std::ignore = source_bit;
+            std::ignore = target_bit;
+            return true;
+        }
+    };
 
-        // single push
-        const bool target_single_push_is_free = target_single_push & free_squares;
-        if (target_single_push_is_free)
+    const Bitboard en_passant_square = position[kExtrasBoard] & kBoardMaskEnPassant;
+    constexpr std::array<std::size_t, 2> white_capture_directions{kNorthWest, kNorthEast};
+    constexpr std::array<std::size_t, 2> black_capture_directions{kSouthWest, kSouthEast};
+    for (const std::size_t capture_direction : white_to_move ? white_capture_directions : black_capture_directions)
+    {
+        const int capture_bits = kStepBits[capture_direction];
+        const Bitboard capture_targets = SingleStep(pawns, capture_direction);
+        for (Bitboard targets = capture_targets & position[defending_side] & targets_of_pieces_other_than_king;
+             targets;
+             targets &= targets - 1)
         {
-            const bool is_promotion = target_single_push & kPromotionRanks;
-            const Bitmove target_single_push_bits = tzcnt(target_single_push);
-            if (!is_promotion)
+            const Bitmove target_bit = tzcnt(targets);
+            if (!stays_on_pin_line(target_bit - capture_bits, target_bit))
             {
-                *move_generation_insertion_iterator++ = ComposeMove(
-                    source_bit, target_single_push_bits, kPawn, kNoCapture, kNoPromotion, kMoveTypePawnSinglePush);
+                continue;
             }
-            else
+            const Bitboard target = Bitboard{1} << target_bit;
+            const Bitmove captured_piece = position.GetPieceKind(defending_side, target);
+            if (target & kPromotionRanks)
             {
-                // promotion (without capture)
                 PushBackAllPromotions(
-                    move_generation_insertion_iterator, source_bit, target_single_push_bits, kNoCapture);
+                    move_generation_insertion_iterator, target_bit - capture_bits, target_bit, captured_piece);
+            }
+            else
+            {
+                *move_generation_insertion_iterator++ = ComposeMove(
+                    target_bit - capture_bits, target_bit, kPawn, captured_piece, kNoPromotion, kMoveTypeCapture);
             }
         }
-
-        // double push
-        const bool source_is_on_start_row =
-            (white_to_move && (source & kStartRankWhite)) || (!white_to_move && (source & kStartRankBlack));
-        if (source_is_on_start_row)
+        if (capture_targets & en_passant_square)
         {
-            const Bitboard target_double_push = white_to_move ? source << 16 : source >> 16;
-            const bool target_double_push_is_free = target_double_push & free_squares;
-            if (target_single_push_is_free && target_double_push_is_free)
+            const Bitmove target_bit = tzcnt(en_passant_square);
+            if (is_en_passant_legal(target_bit - capture_bits, target_bit))
             {
                 *move_generation_insertion_iterator++ = ComposeMove(
-                    source_bit, tzcnt(target_double_push), kPawn, kNoCapture, kNoPromotion, kMoveTypePawnDoublePush);
+                    target_bit - capture_bits, target_bit, kPawn, kPawn, kNoPromotion, kMoveTypeEnPassantCapture);
             }
         }
+    }
+
+    /// @brief Moves to a precomputed set of targets (e.g. a jump, where possible in between squares are ignored)
+    const auto generate_moves_to_targets = [&](const Bitmove source_bit,
+                                               const Bitboard targets,
+                                               const std::size_t moved_piece) {
+        for (Bitboard captures = targets & position[defending_side]; captures; captures &= captures - 1)
+        {
+            const Bitmove target_bit = tzcnt(captures);
+            const Bitmove captured_piece = position.GetPieceKind(defending_side, Bitboard{1} << target_bit);
+            *move_generation_insertion_iterator++ =
+                ComposeMove(source_bit, target_bit, moved_piece, captured_piece, kNoPromotion, kMoveTypeCapture);
+        }
+        for (Bitboard quiets = targets & free_squares; quiets; quiets &= quiets - 1)
+        {
+            *move_generation_insertion_iterator++ =
+                ComposeMove(source_bit, tzcnt(quiets), moved_piece, kNoCapture, kNoPromotion, kMoveTypeQuietNonPawn);
+        }
     };
-    ForEveryBitInPopulation(position[attacking_side + kPawn], generate_pawn_move);
-
-    /// @brief Ray in the sense that all squares in a certain direction are considered as targets
-    const auto generate_ray_style_move = [&](const std::size_t direction,
-                                             const Bitmove source_bit,
-                                             const Bitboard source,
-                                             const std::size_t moved_piece) {
-        Bitboard target = SingleStep(source, direction);
-        while (target)  // is on the board
+
+    // bishop, rook and queen moves
+    if constexpr (Behavior::use_kogge_stone_sliders)
+    {
+        const Bitboard occupied_squares = ~free_squares;
+        for (const std::size_t moved_piece : {kBishop, kRook, kQueen})
         {
-            const bool target_is_blocked_by_own_piece = target & position[attacking_side];
-            if (target_is_blocked_by_own_piece)
+            for (Bitboard sliders = position[attacking_side + moved_piece]; sliders; sliders &= sliders - 1)
             {
-                break;
+                const Bitmove source_bit = tzcnt(sliders);
+                const Bitboard source = Bitboard{1} << source_bit;
+                const Bitboard targets = SlidingAttacks((moved_piece == kBishop) ? Bitboard{0} : source,
+                                                        (moved_piece == kRook) ? Bitboard{0} : source,
+                                                        occupied_squares);
+                generate_moves_to_targets(
+                    source_bit, restrict_pin(source_bit, targets & targets_of_pieces_other_than_king), moved_piece);
             }
+        }
+    }
+    else
+    {
+        /// @brief Ray in the sense that all squares in a certain direction are considered as targets
+        const auto generate_ray_style_move = [&](const std::size_t direction,
+                                                 const Bitmove source_bit,
+                                                 const Bitboard source,
+                                                 const std::size_t moved_piece) {
+            const Bitboard allowed_targets = restrict_pin(source_bit, targets_of_pieces_other_than_king);
+            Bitboard target = SingleStep(source, direction);
+            while (target)  // is on the board
+            {
+                const bool target_is_blocked_by_own_piece = target & position[attacking_side];
+                if (target_is_blocked_by_own_piece)
+                {
+                    break;
+                }
 
-            const bool target_is_free = target & free_squares;
-            const Bitmove target_bit = tzcnt(target);
-            if (target_is_free)
+                const bool target_is_free = target & free_squares;
+                const bool target_is_allowed = target & allowed_targets;
+                const Bitmove target_bit = tzcnt(target);
+                if (target_is_free)
+                {
+                    if (target_is_allowed)
+                    {
+                        *move_generation_insertion_iterator++ = ComposeMove(
+                            source_bit, target_bit, moved_piece, kNoCapture, kNoPromotion, kMoveTypeQuietNonPawn);
+                    }
+                }
+                else  // target occupied by opposing piece
+                {
+                    if (target_is_allowed)
+                    {
+                        const Bitmove captured_piece = position.GetPieceKind(defending_side, target);
+                        *move_generation_insertion_iterator++ = ComposeMove(
+                            source_bit, target_bit, moved_piece, captured_piece, kNoPromotion, kMoveTypeCapture);
+                    }
+                    break;
+                }
+                target = SingleStep(target, direction);
+            }
+        };
+
+        // bishop moves
+        const auto generate_bishop_move = [&](const Bitmove source_bit, const Bitboard source) {
+            for (const auto direction : bishop_directions)
             {
-                *move_generation_insertion_iterator++ =
-                    ComposeMove(source_bit, target_bit, moved_piece, kNoCapture, kNoPromotion, kMoveTypeQuietNonPawn);
+                generate_ray_style_move(direction, source_bit, source, kBishop);
             }
-            else  // target occupied by opposing piece
+        };
+        ForEveryBitInPopulation(position[attacking_side + kBishop], generate_bishop_move);
+
+        // rook moves
+        const auto generate_rook_move = [&](const Bitmove source_bit, const Bitboard source) {
+            for (const auto direction : rook_directions)
             {
-                const Bitmove captured_piece = position.GetPieceKind(defending_side, target);
-                *move_generation_insertion_iterator++ =
-                    ComposeMove(source_bit, target_bit, moved_piece, captured_piece, kNoPromotion, kMoveTypeCapture);
-                break;
+                generate_ray_style_move(direction, source_bit, source, kRook);
             }
-            target = SingleStep(target, direction);
-        }
-    };
+        };
+        ForEveryBitInPopulation(position[attacking_side + kRook], generate_rook_move);
+
+        // queen moves
+        const auto generate_queen_move = [&](const Bitmove source_bit, const Bitboard source) {
+            for (const auto direction : all_directions)
+            {
+                generate_ray_style_move(direction, source_bit, source, kQueen);
+            }
+        };
+        ForEveryBitInPopulation(position[attacking_side + kQueen], generate_queen_move);
+    }
+
+    // knight moves
+    for (Bitboard knights = position[attacking_side + kKnight]; knights; knights &= knights - 1)
+    {
+        const Bitmove source_bit = tzcnt(knights);
+        const Bitboard targets = kKnightJumps[source_bit] & targets_of_pieces_other_than_king;
+        generate_moves_to_targets(source_bit, restrict_pin(source_bit, targets), kKnight);
+    }
+
+    // king moves
+    if (king_board)  // is on the board (not in all positions of tests)
+    {
+        generate_moves_to_targets(king_bit, kKingAttacks[king_bit] & targets_of_king, kKing);
+    }
+
+    // castling
+    const MoveStack::iterator begin_of_castling_moves = move_generation_insertion_iterator;
+    move_generation_insertion_iterator = GenerateCastlingMoves(position, move_generation_insertion_iterator);
+    if constexpr (only_legal_moves)
+    {
+        const auto passes_attacked_square = [&check_state, king_board](const Bitmove move) {
+            const Bitboard target = Bitboard{1} << ExtractTarget(move);
+            const Bitboard pass_through_square =
+                ((move & kMoveMaskType) == kMoveTypeKingsideCastling) ? king_board >> 1 : king_board << 1;
+            return check_state.IsInCheck() || (check_state.king_danger_squares & (pass_through_square | target));
+        };
+        move_generation_insertion_iterator =
+            std::remove_if(begin_of_castling_moves, move_generation_insertion_iterator, passes_attacked_square);
+    }
+
+    AssertFitsIntoMoveList(begin_of_move_list, move_generation_insertion_iterator);
+    return move_generation_insertion_iterator;
+}
+
+/// @brief Generates all pseudo legal moves from given position
+///
+/// "Pseudo" in the sense that the king may be in check after generated move.
+///
+/// @returns An iterator pointing to the element past the last generated move
+template <typename Behavior = GenerateAllPseudoLegalMoves>
+std::enable_if_t<Behavior::generate_all_legal_moves, MoveStack::iterator> GenerateMoves(
+    const Position& position,
+    MoveStack::iterator move_generation_insertion_iterator)
+{
+    return GenerateAllMoves<Behavior, false>(position, CheckState{}, move_generation_insertion_iterator);
+}
+
+/// @brief Generates all legal moves from given position, given the CheckState of its side to move
+///
+/// Replaces generating all pseudo legal moves and filtering them with IsLegal.
+///
+/// @returns An iterator pointing to the element past the last generated move
+template <typename Behavior = GenerateAllPseudoLegalMoves>
+std::enable_if_t<Behavior::generate_all_legal_moves, MoveStack::iterator> GenerateMoves(
+    const Position& position,
+    const CheckState& check_state,
+    MoveStack::iterator move_generation_insertion_iterator)
+{
+    return GenerateAllMoves<Behavior, true>(position, check_state, move_generation_insertion_iterator);
+}
+
+/// @brief Generates the pseudo legal quiet moves from given position which give check (see GenerateQuietChecks)
+///
+/// Rather than generating all quiet moves, targets are restricted to the squares attacking the opposing king (looked
+/// up for knights and pawns, filled from the king for sliders). Only own pieces between the opposing king and an own
+/// slider may move anywhere off that line.
+///
+/// @returns An iterator pointing to the element past the last generated move
+template <typename Behavior>
+std::enable_if_t<Behavior::generate_quiet_checks, MoveStack::iterator> GenerateMoves(
+    const Position& position,
+    MoveStack::iterator move_generation_insertion_iterator)
+{
+    const MoveStack::iterator begin_of_move_list = move_generation_insertion_iterator;
+    const bool white_to_move = position.IsWhiteToMove();
+    const std::size_t attacking_side = position.GetAttackingSide();
+    const Bitboard opposing_king = position[position.GetDefendingSide() + kKing];
+    if (!opposing_king)  // only in artificial positions
+    {
+        return move_generation_insertion_iterator;
+    }
+    const Bitmove opposing_king_bit = tzcnt(opposing_king);
+    const Bitboard occupied_squares = position[kOccupiedBoard];
+    const Bitboard free_squares = ~occupied_squares;
+
+    // squares to give check from directly
+    const Bitboard rook_checks = SlidingAttacks(opposing_king, Bitboard{0}, occupied_squares);
+    const Bitboard bishop_checks = SlidingAttacks(Bitboard{0}, opposing_king, occupied_squares);
+    const Bitboard knight_checks = kKnightJumps[opposing_king_bit];
+    const Bitboard pawn_checks =
+        kPawnAttacks[opposing_king_bit + white_to_move * kPawnAttacksLookupTableOffsetForWhite];
+
+    // own pieces which may uncover a check, i.e. the first piece from the opposing king on a line with own sliders
+    const Bitboard rook_sliders = position[attacking_side + kRook] | position[attacking_side + kQueen];
+    const Bitboard bishop_sliders = position[attacking_side + kBishop] | position[attacking_side + kQueen];
+    Bitboard discovery_candidates{0};
+    if (kRookAttacks[opposing_king_bit] & rook_sliders)
+    {
+        discovery_candidates |= rook_checks & position[attacking_side];
+    }
+    if (kBishopAttacks[opposing_king_bit] & bishop_sliders)
+    {
+        discovery_candidates |= bishop_checks & position[attacking_side];
+    }
 
-    // bishop moves
-    const auto generate_bishop_move = [&](const Bitmove source_bit, const Bitboard source) {
-        for (const auto direction : bishop_directions)
+    /// @brief Targets where the piece on source uncovers a check, i.e. all squares off the line between the opposing
+    /// king and the slider behind the piece (none if there is no such slider).
+    const auto discovered_checks = [&](const Bitboard source) {
+        if (!(source & discovery_candidates))
         {
-            generate_ray_style_move(direction, source_bit, source, kBishop);
+            return Bitboard{0};
         }
-    };
-    ForEveryBitInPopulation(position[attacking_side + kBishop], generate_bishop_move);
-
-    // rook moves
-    const auto generate_rook_move = [&](const Bitmove source_bit, const Bitboard source) {
-        for (const auto direction : rook_directions)
+        const Bitboard occupied_squares_without_source = occupied_squares & ~source;
+        const Bitboard uncovered_rook_line =
+            SlidingAttacks(opposing_king, Bitboard{0}, occupied_squares_without_source);
+        const Bitboard uncovered_rook_slider = uncovered_rook_line & ~rook_checks & rook_sliders;
+        if (uncovered_rook_slider)
         {
-            generate_ray_style_move(direction, source_bit, source, kRook);
+            return ~(uncovered_rook_line &
+                     SlidingAttacks(uncovered_rook_slider, Bitboard{0}, occupied_squares_without_source));
         }
-    };
-    ForEveryBitInPopulation(position[attacking_side + kRook], generate_rook_move);
-
-    // queen moves
-    const auto generate_queen_move = [&](const Bitmove source_bit, const Bitboard source) {
-        for (const auto direction : all_directions)
+        const Bitboard uncovered_bishop_line =
+            SlidingAttacks(Bitboard{0}, opposing_king, occupied_squares_without_source);
+        const Bitboard uncovered_bishop_slider = uncovered_bishop_line & ~bishop_checks & bishop_sliders;
+        if (uncovered_bishop_slider)
         {
-            generate_ray_style_move(direction, source_bit, source, kQueen);
+            return ~(uncovered_bishop_line &
+                     SlidingAttacks(Bitboard{0}, uncovered_bishop_slider, occupied_squares_without_source));
         }
+        return Bitboard{0};
     };
-    ForEveryBitInPopulation(position[attacking_side + kQueen], generate_queen_move);
 
-    /// @brief Jump in the sense that only target and source are considered (possible in between squares are ignored)
-    const auto generate_jump_style_move = [&](const Bitboard source,
-                                              const Bitboard target,
-                                              const std::size_t moved_piece) {
-        if (target)  // is on the board?
+    // pawn pushes (promotions are left out, as they are no quiet moves)
+    const Bitboard pawns = position[attacking_side + kPawn];
+    const std::size_t forward = white_to_move ? kNorth : kSouth;
+    const int forward_bits = kStepBits[forward];
+    const Bitboard double_push_rank = white_to_move ? kRank3 : kRank6;
+    const auto generate_pawn_pushes = [&](const Bitboard pawns_to_push, const Bitboard checks) {
+        const Bitboard target_single_pushes = SingleStep(pawns_to_push, forward) & free_squares;
+        const Bitboard target_double_pushes =
+            SingleStep(target_single_pushes & double_push_rank, forward) & free_squares;
+        for (Bitboard targets = target_single_pushes & ~kPromotionRanks & checks; targets; targets &= targets - 1)
         {
-            const Bitmove source_bit = tzcnt(source);
-            const Bitmove target_bit = tzcnt(target);
-            const bool target_is_free = target & free_squares;
-            if (target_is_free)
-            {
-                *move_generation_insertion_iterator++ =
-                    ComposeMove(source_bit, target_bit, moved_piece, kNoCapture, kNoPromotion, kMoveTypeQuietNonPawn);
-                return;
-            }
-            const bool target_is_occupied_by_opponents_piece = target & position[defending_side];
-            if (target_is_occupied_by_opponents_piece)
-            {
-                const Bitmove captured_piece = position.GetPieceKind(defending_side, target);
-                *move_generation_insertion_iterator++ =
-                    ComposeMove(source_bit, target_bit, moved_piece, captured_piece, kNoPromotion, kMoveTypeCapture);
-            }
+            const Bitmove target_bit = tzcnt(targets);
+            *move_generation_insertion_iterator++ = ComposeMove(
+                target_bit - forward_bits, target_bit, kPawn, kNoCapture, kNoPromotion, kMoveTypePawnSinglePush);
+        }
+        for (Bitboard targets = target_double_pushes & checks; targets; targets &= targets - 1)
+        {
+            const Bitmove target_bit = tzcnt(targets);
+            *move_generation_insertion_iterator++ = ComposeMove(
+                target_bit - 2 * forward_bits, target_bit, kPawn, kNoCapture, kNoPromotion, kMoveTypePawnDoublePush);
         }
     };
+    generate_pawn_pushes(pawns & ~discovery_candidates, pawn_checks);
+    for (Bitboard discovering_pawns = pawns & discovery_candidates; discovering_pawns;
+         discovering_pawns &= discovering_pawns - 1)
+    {
+        const Bitboard source = Bitboard{1} << tzcnt(discovering_pawns);
+        generate_pawn_pushes(source, pawn_checks | discovered_checks(source));
+    }
 
-    // knight moves
-    const auto generate_knight_move = [&](const Bitmove /*unused*/, const Bitboard source) {
-        for (const auto jump_direction : kKnightDirections)
+    const auto generate_quiet_moves_to_targets = [&](const Bitmove source_bit,
+                                                     const Bitboard targets,
+                                                     const std::size_t moved_piece) {
+        for (Bitboard quiets = targets & free_squares; quiets; quiets &= quiets - 1)
         {
-            const Bitboard target = RuntimeKnightJump(source, jump_direction);
-            generate_jump_style_move(source, target, kKnight);
+            *move_generation_insertion_iterator++ =
+                ComposeMove(source_bit, tzcnt(quiets), moved_piece, kNoCapture, kNoPromotion, kMoveTypeQuietNonPawn);
         }
     };
-    ForEveryBitInPopulation(position[attacking_side + kKnight], generate_knight_move);
 
-    // king moves
-    const Bitboard king_board = position[attacking_side + kKing];
-    for (const auto direction : all_directions)
+    // knight moves
+    for (Bitboard knights = position[attacking_side + kKnight]; knights; knights &= knights - 1)
     {
-        const Bitboard target = SingleStep(king_board, direction);
-        generate_jump_style_move(king_board, target, kKing);
+        const Bitmove source_bit = tzcnt(knights);
+        const Bitboard source = Bitboard{1} << source_bit;
+        generate_quiet_moves_to_targets(
+            source_bit, kKnightJumps[source_bit] & (knight_checks | discovered_checks(source)), kKnight);
     }
 
-    // castling
-    constexpr std::array<Bitboard, 4> castling_rights{
-        kCastlingBlackKingside, kCastlingBlackQueenside, kCastlingWhiteKingside, kCastlingWhiteQueenside};
-    constexpr std::array<Bitboard, 4> neccessary_free_squares = {F8 | G8, D8 | C8 | B8, F1 | G1, D1 | C1 | B1};
-    constexpr Bitmove black_king_source_bits = 59;
-    constexpr Bitmove white_king_source_bits = 3;
-    constexpr std::array<int, 4> target_bits{57, 61, 1, 5};
-    constexpr Bitmove black_kingside = ComposeMove(
-        black_king_source_bits, std::get<0>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeKingsideCastling);
-    constexpr Bitmove black_queenside = ComposeMove(
-        black_king_source_bits, std::get<1>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeQueensideCastling);
-    constexpr Bitmove white_kingside = ComposeMove(
-        white_king_source_bits, std::get<2>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeKingsideCastling);
-    constexpr Bitmove white_queenside = ComposeMove(
-        white_king_source_bits, std::get<3>(target_bits), kKing, kNoCapture, kNoPromotion, kMoveTypeQueensideCastling);
-    constexpr std::array<Bitmove, 4> castling_moves{black_kingside, black_queenside, white_kingside, white_queenside};
-
-    const std ::size_t offset_for_white = 2 * white_to_move;
-    for (const std::size_t side : {0, 1})  // side as in queen- or kingside, not white or black
+    // bishop, rook and queen moves
+    for (const std::size_t moved_piece : {kBishop, kRook, kQueen})
     {
-        const std::size_t castling = side + offset_for_white;
-        const bool castling_to_side_is_allowed =
-            (position[kExtrasBoard] & castling_rights[castling]) == castling_rights[castling];
-        const bool space_between_king_and_rook_is_free =
-            (free_squares & neccessary_free_squares[castling]) == neccessary_free_squares[castling];
-        const bool castling_possible = castling_to_side_is_allowed && space_between_king_and_rook_is_free;
-        if (castling_possible)
+        const Bitboard checks = ((moved_piece == kBishop) ? Bitboard{0} : rook_checks) |
+                                ((moved_piece == kRook) ? Bitboard{0} : bishop_checks);
+        for (Bitboard sliders = position[attacking_side + moved_piece]; sliders; sliders &= sliders - 1)
         {
-            *move_generation_insertion_iterator++ = castling_moves[castling];
+            const Bitmove source_bit = tzcnt(sliders);
+            const Bitboard source = Bitboard{1} << source_bit;
+            const Bitboard targets = SlidingAttacks((moved_piece == kBishop) ? Bitboard{0} : source,
+                                                    (moved_piece == kRook) ? Bitboard{0} : source,
+                                                    occupied_squares);
+            generate_quiet_moves_to_targets(source_bit, targets & (checks | discovered_checks(source)), moved_piece);
         }
     }
 
+    // king moves (only by discovery, and never next to the opposing king)
+    const Bitboard king_board = position[attacking_side + kKing];
+    if (king_board)  // is on the board (not in all positions of tests)
+    {
+        const Bitmove source_bit = tzcnt(king_board);
+        const Bitboard targets = kKingAttacks[source_bit] & ~kKingAttacks[opposing_king_bit];
+        generate_quiet_moves_to_targets(source_bit, targets & discovered_checks(king_board), kKing);
+    }
+
+    // castling, which can only give check by the rook from its target square (the king uncovers nothing on the back
+    // rank), with the squares king and rook left being vacated
+    const MoveStack::iterator begin_of_castling_moves = move_generation_insertion_iterator;
+    move_generation_insertion_iterator = GenerateCastlingMoves(position, move_generation_insertion_iterator);
+    const auto gives_no_check = [occupied_squares, opposing_king](const Bitmove move) {
+        const Bitboard king_source = Bitboard{1} << ExtractSource(move);
+        const Bitboard king_target = Bitboard{1} << ExtractTarget(move);
+        const bool is_kingside = (move & kMoveMaskType) == kMoveTypeKingsideCastling;
+        const Bitboard rook_source = is_kingside ? (king_target >> 1) : (king_target << 2);
+        const Bitboard rook_target = is_kingside ? (king_target << 1) : (king_target >> 1);
+        const Bitboard occupied_squares_after_castling =
+            (occupied_squares & ~(king_source | rook_source)) | king_target | rook_target;
+        return !(SlidingAttacks(rook_target, Bitboard{0}, occupied_squares_after_castling) & opposing_king);
+    };
+    move_generation_insertion_iterator =
+        std::remove_if(begin_of_castling_moves, move_generation_insertion_iterator, gives_no_check);
+
+    AssertFitsIntoMoveList(begin_of_move_list, move_generation_insertion_iterator);
     return move_generation_insertion_iterator;
 }
 
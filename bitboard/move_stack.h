@@ -4,15 +4,68 @@
 #include "bitboard/move.h"
 
 #include <array>
+#include <cassert>
+#include <iterator>
 #include <sstream>
+#include <tuple>
 
 namespace Chess
 {
 
-/// @brief Type to preallocate memory for multiple layers of candidate moves during move generation.
+/// @brief Capacity of the move list of a single ply, beyond the most moves known for any position (218).
+constexpr std::size_t kMoveListCapacity{256};
+
+/// @brief One move list per ply of the searched path (root plus up to 128 plies, like PositionStack).
+constexpr std::size_t kNumberOfMoveLists{129};
+
+/// @brief Never generated (no piece is encoded by all bits), marks the end of the move stack in debug checks.
+constexpr Bitmove kEndOfMoveStack{~Bitmove{0}};
+
+static_assert(kMoveListCapacity > 218, "A move list which starts inside the move stack must not overrun.");
+
+/// @brief Type to preallocate memory for the candidate moves of every ply during move generation.
 ///
 /// These moves will be used during search to update the current position one move at a time (also taking it back).
-using MoveStack = std::array<Bitmove, 1000>;
+/// Every ply generates into a list of its own, which starts at a cache line (e.g. for scoring its moves with SIMD) and
+/// is followed by the list of the next ply (see NextMoveList). As nothing is ever reallocated, every search (i.e. every
+/// thread searching) simply owns a move stack.
+class alignas(64) MoveStack
+{
+  public:
+    /// One more than the lists hold: end() points to kEndOfMoveStack rather than past the storage.
+    using Moves = std::array<Bitmove, kMoveListCapacity * kNumberOfMoveLists + 1>;
+    using iterator = Moves::iterator;
+    using const_iterator = Moves::const_iterator;
+
+    MoveStack() { moves_.back() = kEndOfMoveStack; }
+
+    iterator begin() { return moves_.begin(); }
+    iterator end() { return std::prev(moves_.end()); }
+    const_iterator begin() const { return moves_.begin(); }
+    const_iterator end() const { return std::prev(moves_.end()); }
+
+  private:
+    Moves moves_{};
+};
+
+/// @brief Returns where the next ply generates its moves, given where the current ply generates its moves.
+///
+/// The list of the last ply has no next one, which is asserted before anything gets written there.
+inline MoveStack::iterator NextMoveList(const MoveStack::iterator begin_of_move_list)
+{
+    const MoveStack::iterator begin_of_next_move_list = begin_of_move_list + kMoveListCapacity;
+    assert(*begin_of_next_move_list != kEndOfMoveStack);
+    return begin_of_next_move_list;
+}
+
+/// @brief Debug check that moves generated into a move list did not overrun its capacity.
+inline void AssertFitsIntoMoveList(const MoveStack::iterator begin_of_move_list,
+                                   const MoveStack::iterator end_of_move_list)
+{
+    assert(static_cast<std::size_t>(end_of_move_list - begin_of_move_list) <= kMoveListCapacity);
+    std::ignore = begin_of_move_list;
+    std::ignore = end_of_move_list;  // Resolve warning if assertions are disabled.
+}
 
 inline std::string ToString(const MoveStack& move_stack)
 {
@@ -31,4 +84,4 @@ inline std::string ToString(const MoveStack& move_stack)
 
 }  // namespace Chess
 
-#endif
\ No newline at end of file
+#endif
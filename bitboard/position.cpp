@@ -57,8 +57,11 @@ Bitboard Position::MakeMove(Bitmove move)
     const Bitboard current_extras = boards_[kExtrasBoard];  // These extras correspond to move from function
                                                             // parameter including unaltered en passant information etc.
 
+    const bool white_to_move = IsWhiteToMove();
+    const std::size_t attacking_side = GetAttackingSide();
+    const std::size_t defending_side = GetDefendingSide();
     const std::size_t attacking_piece = ExtractMovedPiece(move);
-    const std::size_t attacking_piece_index = attacking_side_ + attacking_piece;
+    const std::size_t attacking_piece_index = attacking_side + attacking_piece;
 
     const Bitboard source = Bitboard{1} << ExtractSource(move);
     const Bitboard target = Bitboard{1} << ExtractTarget(move);
@@ -70,7 +73,7 @@ Bitboard Position::MakeMove(Bitmove move)
     boards_[kExtrasBoard] &= ~(obsolete_extras_from_last_move | castling_rights_to_revoke);
     boards_[kExtrasBoard] += kIncrementTotalPlies;
 
-    boards_[attacking_side_] ^= source_and_target;
+    boards_[attacking_side] ^= source_and_target;
     boards_[attacking_piece_index] ^= source_and_target;
 
     const Bitmove move_type = move & kMoveMaskType;
@@ -81,28 +84,28 @@ Bitboard Position::MakeMove(Bitmove move)
             break;
         }
         case kMoveTypeCapture: {
-            const std::size_t captured_piece = defending_side_ + ExtractCapturedPiece(move);
-            boards_[defending_side_] &= ~target;
+            const std::size_t captured_piece = defending_side + ExtractCapturedPiece(move);
+            boards_[defending_side] &= ~target;
             boards_[captured_piece] &= ~target;
             break;
         }
         case kMoveTypePawnDoublePush: {
-            const Bitboard en_passant_square = white_to_move_ ? source << 8 : source >> 8;
+            const Bitboard en_passant_square = white_to_move ? source << 8 : source >> 8;
             boards_[kExtrasBoard] |= en_passant_square;
             break;
         }
         case kMoveTypeEnPassantCapture: {
-            const Bitboard en_passant_victim = white_to_move_ ? target >> 8 : target << 8;
-            boards_[defending_side_] &= ~en_passant_victim;
-            boards_[defending_side_ + kPawn] &= ~en_passant_victim;
+            const Bitboard en_passant_victim = white_to_move ? target >> 8 : target << 8;
+            boards_[defending_side] &= ~en_passant_victim;
+            boards_[defending_side + kPawn] &= ~en_passant_victim;
             break;
         }
         case kMoveTypeKingsideCastling: {
             constexpr Bitboard white_rook_jump = F1 | H1;
             constexpr Bitboard black_rook_jump = F8 | H8;
-            const Bitboard rook_jump_source_and_target = white_to_move_ ? white_rook_jump : black_rook_jump;
-            boards_[attacking_side_] ^= rook_jump_source_and_target;
-            boards_[attacking_side_ + kRook] ^= rook_jump_source_and_target;
+            const Bitboard rook_jump_source_and_target = white_to_move ? white_rook_jump : black_rook_jump;
+            boards_[attacking_side] ^= rook_jump_source_and_target;
+            boards_[attacking_side + kRook] ^= rook_jump_source_and_target;
             boards_[kExtrasBoard] |= kBoardMaskKingsideCastlingOnLastMove |
                                      ((current_extras & kBoardMaskStaticPlies) + kIncrementStaticPlies);
             break;
@@ -110,116 +113,116 @@ Bitboard Position::MakeMove(Bitmove move)
         case kMoveTypeQueensideCastling: {
             constexpr Bitboard white_rook_jump = A1 | D1;
             constexpr Bitboard black_rook_jump = A8 | D8;
-            const Bitboard rook_jump_source_and_target = white_to_move_ ? white_rook_jump : black_rook_jump;
-            boards_[attacking_side_] ^= rook_jump_source_and_target;
-            boards_[attacking_side_ + kRook] ^= rook_jump_source_and_target;
+            const Bitboard rook_jump_source_and_target = white_to_move ? white_rook_jump : black_rook_jump;
+            boards_[attacking_side] ^= rook_jump_source_and_target;
+            boards_[attacking_side + kRook] ^= rook_jump_source_and_target;
             boards_[kExtrasBoard] |= kBoardMaskQueensideCastlingOnLastMove |
                                      ((current_extras & kBoardMaskStaticPlies) + kIncrementStaticPlies);
             break;
         }
         case kMoveTypePromotion: {
-            const std::size_t board_idx_added_piece_kind = attacking_side_ + ExtractPromotion(move);
+            const std::size_t board_idx_added_piece_kind = attacking_side + ExtractPromotion(move);
             boards_[attacking_piece_index] &=
                 ~source_and_target;  // pawn was moved to target as side effect of default operation earlier
             boards_[board_idx_added_piece_kind] |= target;
             const Bitmove capture = move & kMoveMaskCapturedPiece;
             if (capture)
             {
-                const std::size_t captured_piece = defending_side_ + (capture >> kMoveShiftCapturedPiece);
-                boards_[defending_side_] &= ~target;
+                const std::size_t captured_piece = defending_side + (capture >> kMoveShiftCapturedPiece);
+                boards_[defending_side] &= ~target;
                 boards_[captured_piece] &= ~target;
             }
             break;
         }
     }
 
-    white_to_move_ = !white_to_move_;
-    attacking_side_ ^= kToggleSide;
-    defending_side_ ^= kToggleSide;
+    boards_[kExtrasBoard] ^= kBoardMaskBlackToMove;
+    UpdateOccupiedSquares();
 
     return current_extras;
 }
 
 void Position::UnmakeMove(Bitmove move, Bitboard saved_extras)
 {
-    boards_[kExtrasBoard] = saved_extras;
-    white_to_move_ = !white_to_move_;
-    attacking_side_ ^= kToggleSide;
-    defending_side_ ^= kToggleSide;
+    boards_[kExtrasBoard] = saved_extras;  // also gives the move back to the side which made it
+    const bool white_to_move = IsWhiteToMove();
+    const std::size_t attacking_side = GetAttackingSide();
+    const std::size_t defending_side = GetDefendingSide();
 
-    const std::size_t attacking_piece_index = attacking_side_ + ExtractMovedPiece(move);
+    const std::size_t attacking_piece_index = attacking_side + ExtractMovedPiece(move);
 
     const Bitboard source = Bitboard{1} << ExtractSource(move);
     const Bitboard target = Bitboard{1} << ExtractTarget(move);
     const Bitboard source_and_target = source | target;
 
-    boards_[attacking_side_] ^= source_and_target;
+    boards_[attacking_side] ^= source_and_target;
     boards_[attacking_piece_index] ^= source_and_target;
 
     const Bitmove move_type = move & kMoveMaskType;
     switch (move_type)
     {
         case kMoveTypeCapture: {
-            const std::size_t captured_piece = defending_side_ + ExtractCapturedPiece(move);
-            boards_[defending_side_] |= target;
+            const std::size_t captured_piece = defending_side + ExtractCapturedPiece(move);
+            boards_[defending_side] |= target;
             boards_[captured_piece] |= target;
-            return;
+            break;
         }
 
         case kMoveTypeEnPassantCapture: {
-            const Bitboard en_passant_victim = white_to_move_ ? target >> 8 : target << 8;
-            boards_[defending_side_] |= en_passant_victim;
-            boards_[defending_side_ + kPawn] |= en_passant_victim;
-            return;
+            const Bitboard en_passant_victim = white_to_move ? target >> 8 : target << 8;
+            boards_[defending_side] |= en_passant_victim;
+            boards_[defending_side + kPawn] |= en_passant_victim;
+            break;
         }
         case kMoveTypeKingsideCastling: {
             constexpr Bitboard white_rook_jump = F1 | H1;
             constexpr Bitboard black_rook_jump = F8 | H8;
-            const Bitboard rook_jump_source_and_target = white_to_move_ ? white_rook_jump : black_rook_jump;
-            boards_[attacking_side_] ^= rook_jump_source_and_target;
-            boards_[attacking_side_ + kRook] ^= rook_jump_source_and_target;
-            return;
+            const Bitboard rook_jump_source_and_target = white_to_move ? white_rook_jump : black_rook_jump;
+            boards_[attacking_side] ^= rook_jump_source_and_target;
+            boards_[attacking_side + kRook] ^= rook_jump_source_and_target;
+            break;
         }
         case kMoveTypeQueensideCastling: {
             constexpr Bitboard white_rook_jump = A1 | D1;
             constexpr Bitboard black_rook_jump = A8 | D8;
-            const Bitboard rook_jump_source_and_target = white_to_move_ ? white_rook_jump : black_rook_jump;
-            boards_[attacking_side_] ^= rook_jump_source_and_target;
-            boards_[attacking_side_ + kRook] ^= rook_jump_source_and_target;
-            return;
+            const Bitboard rook_jump_source_and_target = white_to_move ? white_rook_jump : black_rook_jump;
+            boards_[attacking_side] ^= rook_jump_source_and_target;
+            boards_[attacking_side + kRook] ^= rook_jump_source_and_target;
+            break;
         }
         case kMoveTypePromotion: {
             boards_[attacking_piece_index] &=
                 ~target;  // pawns were set on target and source as side effect of default operation
-            const std::size_t board_idx_added_piece_kind = attacking_side_ + ExtractPromotion(move);
+            const std::size_t board_idx_added_piece_kind = attacking_side + ExtractPromotion(move);
             boards_[board_idx_added_piece_kind] &= ~target;
             const Bitmove capture = move & kMoveMaskCapturedPiece;
             if (capture)
             {
-                const std::size_t captured_piece = defending_side_ + (capture >> kMoveShiftCapturedPiece);
-                boards_[defending_side_] |= target;
+                const std::size_t captured_piece = defending_side + (capture >> kMoveShiftCapturedPiece);
+                boards_[defending_side] |= target;
                 boards_[captured_piece] |= target;
             }
-            return;
+            break;
         }
     }
+
+    UpdateOccupiedSquares();
 }
 
-Bitboard& Position::operator[](const std::size_t index)
+void Position::SetWhiteToMove(const bool white_to_move)
 {
-    return boards_[index];
+    boards_[kExtrasBoard] &= ~kBoardMaskBlackToMove;
+    boards_[kExtrasBoard] |= white_to_move ? Bitboard{0} : kBoardMaskBlackToMove;
 }
 
-Bitboard Position::operator[](const std::size_t index) const
+void Position::UpdateOccupiedSquares()
 {
-    return boards_[index];
+    boards_[kOccupiedBoard] = boards_[kBlackBoard] | boards_[kWhiteBoard];
 }
 
 bool operator==(const Position& a, const Position& b)
 {
-    const bool boards_are_equal = a.boards_ == b.boards_;
-    const bool playing_side_is_equal = a.white_to_move_ == b.white_to_move_;
-    return boards_are_equal && playing_side_is_equal;
+    return a.boards_ == b.boards_;  // side to move is part of the extras board
 }
 
 bool Position::IsKingInCheck(const std::size_t defending_side) const
@@ -231,8 +234,7 @@ bool Position::IsKingInCheck(const std::size_t defending_side) const
             Bitboard attacker_location = SingleStep(square, direction);
             while (attacker_location)  // is on the board
             {
-                const bool attacker_location_is_occupied =
-                    attacker_location & (boards_[kBlackBoard] | boards_[kWhiteBoard]);
+                const bool attacker_location_is_occupied = attacker_location & boards_[kOccupiedBoard];
                 if (attacker_location_is_occupied)
                 {
                     const bool dangerous_piece_on_attacker_location =
@@ -293,7 +295,7 @@ bool Position::IsKingInCheck(const std::size_t defending_side) const
 
         // pawn checks
         const bool pawn_is_giving_check =
-            kPawnAttacks[square_bit + (white_to_move_ * kPawnAttacksLookupTableOffsetForWhite)] &
+            kPawnAttacks[square_bit + ((attacking_side == kWhiteBoard) * kPawnAttacksLookupTableOffsetForWhite)] &
             boards_[attacking_side + kPawn];
         if (pawn_is_giving_check)
         {
@@ -11,7 +11,11 @@
 namespace Chess
 {
 
-class Position
+/// @brief Pieces and state of a game, packed into two cache lines.
+///
+/// Besides the pieces of each side, the boards hold the squares occupied by either side (kept up to date by MakeMove
+/// and UnmakeMove) and the extras board, which also holds the side to move.
+class alignas(64) Position
 {
   public:
     /// @brief Updates the position wrt. to given move and returns the "extras" bitboard prior to the move.
@@ -33,15 +37,23 @@ class Position
     std::size_t GetStaticPlies() const;
     std::size_t GetTotalPlies() const;
 
-    Bitboard& operator[](const std::size_t index);
-    Bitboard operator[](const std::size_t index) const;
+    bool IsWhiteToMove() const { return !(boards_[kExtrasBoard] & kBoardMaskBlackToMove); }
+    std::size_t GetAttackingSide() const { return IsWhiteToMove() ? kWhiteBoard : kBlackBoard; }
+    std::size_t GetDefendingSide() const { return IsWhiteToMove() ? kBlackBoard : kWhiteBoard; }
+    void SetWhiteToMove(const bool white_to_move);
 
-    std::array<Bitboard, 17> boards_{};
-    bool white_to_move_{true};
-    std::size_t attacking_side_{kWhiteBoard};
-    std::size_t defending_side_{kBlackBoard};
+    /// @brief Recomputes the occupied squares, which is only needed after setting the boards of pieces directly.
+    void UpdateOccupiedSquares();
+
+    Bitboard& operator[](const std::size_t index) { return boards_[index]; }
+    Bitboard operator[](const std::size_t index) const { return boards_[index]; }
+
+    std::array<Bitboard, kNumberOfBoards> boards_{};
 };
 
+static_assert(sizeof(Position) == 128, "Position is expected to fill exactly two cache lines.");
+static_assert(alignof(Position) == 64, "Position is expected to start at a cache line.");
+
 bool operator==(const Position& a, const Position& b);
 
 }  // namespace Chess
@@ -0,0 +1,178 @@
+#ifndef BITBOARD_PSEUDO_LEGALITY_H
+#define BITBOARD_PSEUDO_LEGALITY_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/board.h"
+#include "bitboard/lookup_table/knight.h"
+#include "bitboard/lookup_table/pawn.h"
+#include "bitboard/lookup_table/piece.h"
+#include "bitboard/move.h"
+#include "bitboard/pieces.h"
+#include "bitboard/position.h"
+#include "bitboard/shift.h"
+#include "bitboard/squares.h"
+
+#include <array>
+
+namespace Chess
+{
+
+/// @brief Whether a slider on source reaches target in one of the given directions without passing an occupied square.
+inline bool IsReachableAlongRays(const Bitboard source,
+                                 const Bitboard target,
+                                 const Bitboard occupied_squares,
+                                 const std::array<std::size_t, 4>& directions)
+{
+    for (const auto direction : directions)
+    {
+        Bitboard square = SingleStep(source, direction);
+        while (square)  // is on the board
+        {
+            if (square == target)
+            {
+                return true;
+            }
+            if (square & occupied_squares)
+            {
+                break;
+            }
+            square = SingleStep(square, direction);
+        }
+    }
+    return false;
+}
+
+/// @brief Whether the given move is among those GenerateMoves yields for the given position.
+///
+/// Meant to validate moves from other sources (e.g. a hash table or killer moves) without generating all moves.
+/// "Pseudo" in the same sense as for GenerateMoves: the king may be in check after the move.
+inline bool IsPseudoLegal(const Position& position, const Bitmove move)
+{
+    if (move & kMoveMaskUnused)
+    {
+        return false;
+    }
+
+    const bool white_to_move = position.IsWhiteToMove();
+    const std::size_t attacking_side = position.GetAttackingSide();
+    const std::size_t defending_side = position.GetDefendingSide();
+    const Bitmove source_bit = ExtractSource(move);
+    const Bitmove target_bit = ExtractTarget(move);
+    const Bitboard source = Bitboard{1} << source_bit;
+    const Bitboard target = Bitboard{1} << target_bit;
+    const std::size_t moved_piece = ExtractMovedPiece(move);
+    const std::size_t captured_piece = ExtractCapturedPiece(move);
+    const std::size_t promotion = ExtractPromotion(move);
+    const Bitmove move_type = move & kMoveMaskType;
+    const Bitboard occupied_squares = position[kOccupiedBoard];
+
+    // piece ownership
+    const bool moved_piece_exists = (moved_piece >= kPawn) && (moved_piece <= kKing);
+    const bool target_is_blocked_by_own_piece = target & position[attacking_side];
+    if (!moved_piece_exists || !(position[attacking_side + moved_piece] & source) || target_is_blocked_by_own_piece)
+    {
+        return false;
+    }
+
+    // castling (moves are composed exactly like in GenerateMoves)
+    if ((move_type == kMoveTypeKingsideCastling) || (move_type == kMoveTypeQueensideCastling))
+    {
+        const bool is_kingside = move_type == kMoveTypeKingsideCastling;
+        const Bitboard castling_right = white_to_move
+                                            ? (is_kingside ? kCastlingWhiteKingside : kCastlingWhiteQueenside)
+                                            : (is_kingside ? kCastlingBlackKingside : kCastlingBlackQueenside);
+        const Bitboard neccessary_free_squares =
+            white_to_move ? (is_kingside ? F1 | G1 : D1 | C1 | B1) : (is_kingside ? F8 | G8 : D8 | C8 | B8);
+        const Bitmove king_source_bit = white_to_move ? 3 : 59;
+        const Bitmove king_target_bit = is_kingside ? king_source_bit - 2 : king_source_bit + 2;
+        const bool castling_is_allowed = (position[kExtrasBoard] & castling_right) == castling_right;
+        const bool space_between_king_and_rook_is_free = !(occupied_squares & neccessary_free_squares);
+        return castling_is_allowed && space_between_king_and_rook_is_free &&
+               (move == ComposeMove(king_source_bit, king_target_bit, kKing, kNoCapture, kNoPromotion, move_type));
+    }
+
+    // en passant
+    const std::array<Bitboard, 2>& pawn_capture_targets =
+        kPawnCaptureLookupTable[source_bit + kPawnCapturesLookupTableOffsetForBlack * !white_to_move];
+    const bool target_is_pawn_capture_target =
+        target & (std::get<0>(pawn_capture_targets) | std::get<1>(pawn_capture_targets));
+    if (move_type == kMoveTypeEnPassantCapture)
+    {
+        const Bitboard en_passant_square = position[kExtrasBoard] & kBoardMaskEnPassant;
+        return (moved_piece == kPawn) && (captured_piece == kPawn) && (promotion == kNoPromotion) &&
+               (target == en_passant_square) && target_is_pawn_capture_target;
+    }
+
+    // captured piece has to match the occupation of target
+    const bool target_is_occupied_by_opponents_piece = target & position[defending_side];
+    const std::size_t piece_on_target =
+        target_is_occupied_by_opponents_piece ? position.GetPieceKind(defending_side, target) : kNoCapture;
+    if (captured_piece != piece_on_target)
+    {
+        return false;
+    }
+
+    // pawn moves
+    if (moved_piece == kPawn)
+    {
+        const Bitboard target_single_push = white_to_move ? source << 8 : source >> 8;
+        const bool is_single_push = (target == target_single_push) && !target_is_occupied_by_opponents_piece;
+        const bool is_capture = target_is_pawn_capture_target && target_is_occupied_by_opponents_piece;
+        const bool target_is_on_promotion_rank = target & kPromotionRanks;
+        switch (move_type)
+        {
+            case kMoveTypeCapture: {
+                return is_capture && !target_is_on_promotion_rank && (promotion == kNoPromotion);
+            }
+            case kMoveTypePawnSinglePush: {
+                return is_single_push && !target_is_on_promotion_rank && (promotion == kNoPromotion);
+            }
+            case kMoveTypePawnDoublePush: {
+                const Bitboard start_rank = white_to_move ? kStartRankWhite : kStartRankBlack;
+                const Bitboard target_double_push = white_to_move ? source << 16 : source >> 16;
+                return (source & start_rank) && (target == target_double_push) &&
+                       !(occupied_squares & (target_single_push | target_double_push)) && (promotion == kNoPromotion);
+            }
+            case kMoveTypePromotion: {
+                const bool is_promotion_piece = (promotion >= kKnight) && (promotion <= kQueen);
+                return (is_single_push || is_capture) && target_is_on_promotion_rank && is_promotion_piece;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    // non pawn moves
+    const Bitmove expected_move_type = target_is_occupied_by_opponents_piece ? kMoveTypeCapture : kMoveTypeQuietNonPawn;
+    if ((move_type != expected_move_type) || (promotion != kNoPromotion))
+    {
+        return false;
+    }
+    switch (moved_piece)
+    {
+        case kKnight: {
+            return kKnightJumps[source_bit] & target;
+        }
+        case kKing: {
+            return kKingAttacks[source_bit] & target;
+        }
+        case kBishop: {
+            return (kBishopAttacks[source_bit] & target) &&
+                   IsReachableAlongRays(source, target, occupied_squares, bishop_directions);
+        }
+        case kRook: {
+            return (kRookAttacks[source_bit] & target) &&
+                   IsReachableAlongRays(source, target, occupied_squares, rook_directions);
+        }
+        default: {  // queen
+            const auto& directions = (kRookAttacks[source_bit] & target) ? rook_directions : bishop_directions;
+            return ((kRookAttacks[source_bit] | kBishopAttacks[source_bit]) & target) &&
+                   IsReachableAlongRays(source, target, occupied_squares, directions);
+        }
+    }
+}
+
+}  // namespace Chess
+
+#endif
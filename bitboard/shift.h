@@ -17,7 +17,8 @@ constexpr std::array<std::size_t, 4> bishop_directions{kNorthWest, kNorthEast, k
 constexpr std::array<std::size_t, 4> rook_directions{kWest, kNorth, kEast, kSouth};
 
 /// @brief Shifts the given bitboard in the given direction and NULLs the board if "wrap around" occurs.
-/// @pre Assumes that only a single bit is set
+///
+/// Works set-wise as well: every set bit steps at once and only those which would wrap around are dropped.
 inline Bitboard SingleStep(const Bitboard value, const std::size_t direction)
 {
     const int shift = kStepBits[direction];
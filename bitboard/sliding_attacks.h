@@ -0,0 +1,113 @@
+#ifndef BITBOARD_SLIDING_ATTACKS_H
+#define BITBOARD_SLIDING_ATTACKS_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/lookup_table/ray.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace Chess
+{
+
+/// @brief Squares attacked by the given sliders in all eight directions, computed without tables or square by square.
+///
+/// Rook sliders move along ranks and files, bishop sliders along diagonals (queens belong to both). Every direction is
+/// a Kogge-Stone occluded fill: the sliders are smeared over the free squares in steps of one, two and four squares,
+/// then shifted once more onto the first blocker. Attacks include blockers of either side.
+inline Bitboard SlidingAttacksPortable(const Bitboard rook_sliders,
+                                       const Bitboard bishop_sliders,
+                                       const Bitboard occupied_squares)
+{
+    Bitboard attacks{0};
+    for (std::size_t direction{kWest}; direction <= kSouthWest; direction++)
+    {
+        const bool is_diagonal = direction % 2;  // see order of directions in ray.h
+        const int shift = kStepBits[direction];
+        const Bitboard legal_area = kLegalAreasWithoutWrapping[direction];
+        const auto step = [shift](const Bitboard board, const int factor) {
+            return shift > 0 ? board << (shift * factor) : board >> (-shift * factor);
+        };
+
+        Bitboard generator = is_diagonal ? bishop_sliders : rook_sliders;
+        Bitboard propagator = ~occupied_squares & legal_area;
+        generator |= propagator & step(generator, 1);
+        propagator &= step(propagator, 1);
+        generator |= propagator & step(generator, 2);
+        propagator &= step(propagator, 2);
+        generator |= propagator & step(generator, 4);
+        attacks |= step(generator, 1) & legal_area;
+    }
+    return attacks;
+}
+
+#ifdef __AVX2__
+/// @brief Same as SlidingAttacksPortable, but with the four directions of positive and of negative shifts each filled
+/// in parallel in the 64 bit lanes of a 256 bit register.
+inline Bitboard SlidingAttacksAvx2(const Bitboard rook_sliders,
+                                   const Bitboard bishop_sliders,
+                                   const Bitboard occupied_squares)
+{
+    const auto set_lanes = [](const Bitboard a, const Bitboard b, const Bitboard c, const Bitboard d) {
+        return _mm256_setr_epi64x(static_cast<long long>(a),
+                                  static_cast<long long>(b),
+                                  static_cast<long long>(c),
+                                  static_cast<long long>(d));
+    };
+
+    // lanes: west, north west, north, north east (shifted left) or east, south east, south, south west (shifted right)
+    const __m256i shift_1 = _mm256_setr_epi64x(1, 9, 8, 7);
+    const __m256i shift_2 = _mm256_setr_epi64x(2, 18, 16, 14);
+    const __m256i shift_4 = _mm256_setr_epi64x(4, 36, 32, 28);
+    const __m256i sliders = set_lanes(rook_sliders, bishop_sliders, rook_sliders, bishop_sliders);
+    const __m256i free_squares = _mm256_set1_epi64x(static_cast<long long>(~occupied_squares));
+    const __m256i legal_area_left = set_lanes(kLegalAreasWithoutWrapping[kWest],
+                                              kLegalAreasWithoutWrapping[kNorthWest],
+                                              kLegalAreasWithoutWrapping[kNorth],
+                                              kLegalAreasWithoutWrapping[kNorthEast]);
+    const __m256i legal_area_right = set_lanes(kLegalAreasWithoutWrapping[kEast],
+                                               kLegalAreasWithoutWrapping[kSouthEast],
+                                               kLegalAreasWithoutWrapping[kSouth],
+                                               kLegalAreasWithoutWrapping[kSouthWest]);
+
+    __m256i generator_left = sliders;
+    __m256i generator_right = sliders;
+    __m256i propagator_left = _mm256_and_si256(free_squares, legal_area_left);
+    __m256i propagator_right = _mm256_and_si256(free_squares, legal_area_right);
+    const auto fill = [&](const __m256i shift) {
+        const __m256i shifted_generator_left = _mm256_sllv_epi64(generator_left, shift);
+        const __m256i shifted_generator_right = _mm256_srlv_epi64(generator_right, shift);
+        generator_left = _mm256_or_si256(generator_left, _mm256_and_si256(propagator_left, shifted_generator_left));
+        generator_right = _mm256_or_si256(generator_right, _mm256_and_si256(propagator_right, shifted_generator_right));
+        propagator_left = _mm256_and_si256(propagator_left, _mm256_sllv_epi64(propagator_left, shift));
+        propagator_right = _mm256_and_si256(propagator_right, _mm256_srlv_epi64(propagator_right, shift));
+    };
+    fill(shift_1);
+    fill(shift_2);
+    fill(shift_4);  // last update of the propagators is unused
+
+    const __m256i attacks_left = _mm256_and_si256(_mm256_sllv_epi64(generator_left, shift_1), legal_area_left);
+    const __m256i attacks_right = _mm256_and_si256(_mm256_srlv_epi64(generator_right, shift_1), legal_area_right);
+    const __m256i attacks = _mm256_or_si256(attacks_left, attacks_right);
+    const __m128i attacks_of_two_lanes =
+        _mm_or_si128(_mm256_castsi256_si128(attacks), _mm256_extracti128_si256(attacks, 1));
+    return static_cast<Bitboard>(_mm_cvtsi128_si64(attacks_of_two_lanes) | _mm_extract_epi64(attacks_of_two_lanes, 1));
+}
+#endif
+
+/// @brief Squares attacked by the given sliders (see SlidingAttacksPortable), using AVX2 if the build enables it.
+inline Bitboard SlidingAttacks(const Bitboard rook_sliders,
+                               const Bitboard bishop_sliders,
+                               const Bitboard occupied_squares)
+{
+#ifdef __AVX2__
+    return SlidingAttacksAvx2(rook_sliders, bishop_sliders, occupied_squares);
+#else
+    return SlidingAttacksPortable(rook_sliders, bishop_sliders, occupied_squares);
+#endif
+}
+
+}  // namespace Chess
+
+#endif
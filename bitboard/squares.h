@@ -104,6 +104,9 @@ constexpr Bitboard kStartRankWhite = kRank2;
 constexpr Bitboard kStartRankBlack = kRank7;
 constexpr Bitboard kPromotionRanks = kRank1 | kRank8;
 
+constexpr Bitboard kLightSquares{0xAA55AA55AA55AA55};
+constexpr Bitboard kDarkSquares{~kLightSquares};
+
 constexpr std::array<Bitboard, 64> kAllSquares{H1, G1, F1, E1, D1, C1, B1, A1,  //
                                                H2, G2, F2, E2, D2, C2, B2, A2,  //
                                                H3, G3, F3, E3, D3, C3, B3, A3,  //
@@ -0,0 +1,81 @@
+#include "bitboard/attack_maps.h"
+
+#include "bitboard/check_state.h"
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/squares.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace Chess
+{
+namespace
+{
+
+/// Compares updated with recomputed attack maps for all moves down to the given depth.
+void ExpectUpdatedAttackMapsEqualComputedAttackMaps(Position& position,
+                                                    const AttackMaps& attack_maps,
+                                                    const MoveStack::iterator end_before_move_generation,
+                                                    const std::size_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    const MoveStack::iterator end_after_move_generation = GenerateMoves(position, end_before_move_generation);
+    for (auto move = end_before_move_generation; move != end_after_move_generation; move++)
+    {
+        const Bitboard extras_before_move = position.MakeMove(*move);
+        const AttackMaps updated_attack_maps = UpdateAttackMaps(attack_maps, position, *move);
+        ASSERT_EQ(updated_attack_maps, ComputeAttackMaps(position)) << ToString(*move) << FenFromPosition(position);
+        const bool is_legal = !position.IsKingInCheck(position.GetDefendingSide());
+        if (is_legal)  // otherwise the next move may capture a king
+        {
+            ASSERT_FALSE(IsKingAttacked(position, updated_attack_maps, position.GetDefendingSide()));
+            ASSERT_EQ(IsKingAttacked(position, updated_attack_maps, position.GetAttackingSide()),
+                      ComputeCheckState(position).IsInCheck());
+            ExpectUpdatedAttackMapsEqualComputedAttackMaps(
+                position, updated_attack_maps, NextMoveList(end_before_move_generation), depth - 1);
+        }
+        position.UnmakeMove(*move, extras_before_move);
+    }
+}
+
+class AttackMapsTestFixture : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(AttackMapsTestFixture, GivenAllMovesDownToDepth3_ExpectUpdatedAttackMapsEqualComputedOnes)
+{
+    Position position = PositionFromFen(GetParam());
+    MoveStack move_stack{};
+    ExpectUpdatedAttackMapsEqualComputedAttackMaps(position, ComputeAttackMaps(position), move_stack.begin(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    VariousPositions,
+    AttackMapsTestFixture,
+    ::testing::Values(kStandardStartingPosition,
+                      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+
+TEST(AttackMapsTest, GivenStandardStartingPosition_ExpectPawnsAttackThirdAndSixthRank)
+{
+    const AttackMaps attack_maps = ComputeAttackMaps(PositionFromFen(kStandardStartingPosition));
+    EXPECT_EQ(attack_maps[kWhiteBoard + kPawn], kRank3);
+    EXPECT_EQ(attack_maps[kBlackBoard + kPawn], kRank6);
+}
+
+TEST(AttackMapsTest, GivenRookOnOpenFile_ExpectFileAndRankUpToFirstBlocker)
+{
+    const AttackMaps attack_maps = ComputeAttackMaps(PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 0 1"));
+    EXPECT_EQ(attack_maps[kWhiteBoard + kRook], (kFileA & ~A1) | B1 | C1 | D1 | E1);
+    EXPECT_EQ(attack_maps[kWhiteBoard], attack_maps[kWhiteBoard + kRook] | attack_maps[kWhiteBoard + kKing]);
+}
+
+}  // namespace
+}  // namespace Chess
@@ -9,7 +9,7 @@ namespace Chess
 namespace
 {
 
-constexpr std::array<Bitboard, 7> kAllBoardMasks{
+constexpr std::array<Bitboard, 8> kAllBoardMasks{
     kBoardMaskStaticPlies,
     kBoardMaskEnPassant,
     kBoardMaskCastling,
@@ -17,6 +17,7 @@ constexpr std::array<Bitboard, 7> kAllBoardMasks{
     kBoardMaskUnused,
     kBoardMaskKingsideCastlingOnLastMove,
     kBoardMaskQueensideCastlingOnLastMove,
+    kBoardMaskBlackToMove,
 };
 
 TEST(BoardMaskTest, GivenAllBoardMasks_ExpectEntireRangeOfUnderlyingTypeIsUtilized)
@@ -48,12 +49,12 @@ INSTANTIATE_TEST_SUITE_P(AllCombinations,
                          testing::Combine(testing::ValuesIn(kAllBoardMasks), testing::ValuesIn(kAllBoardMasks)));
 
 constexpr Bitboard kAllBitsSet = std::numeric_limits<Bitboard>::max();
-constexpr Bitboard k6BitsSet = 0b00111111;
+constexpr Bitboard k8BitsSet = 0b11111111;
 constexpr Bitboard k16BitsSet = 0b11111111'11111111;
 
-TEST(BoardShiftStaticPliesTest, GivenOnAllOnes_Expect6BitsSet)
+TEST(BoardShiftStaticPliesTest, GivenOnAllOnes_Expect8BitsSet)
 {
-    EXPECT_EQ((kAllBitsSet & kBoardMaskStaticPlies) >> kBoardShiftStaticPlies, k6BitsSet);
+    EXPECT_EQ((kAllBitsSet & kBoardMaskStaticPlies) >> kBoardShiftStaticPlies, k8BitsSet);
 }
 
 TEST(BoardShiftTotalPliesTest, GivenOnAllOnes_Expect16BitsSet)
@@ -0,0 +1,179 @@
+#include "bitboard/check_state.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/squares.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace
+{
+
+/// Compares IsLegal with making the move and testing the own king afterwards for all moves down to the given depth.
+void ExpectIsLegalEqualsKingNotInCheckAfterMove(Position& position,
+                                                const MoveStack::iterator end_before_move_generation,
+                                                const std::size_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    const CheckState check_state = ComputeCheckState(position);
+    const MoveStack::iterator end_after_move_generation =
+        GenerateMoves<GenerateAllPseudoLegalMoves>(position, end_before_move_generation);
+    for (auto move = end_before_move_generation; move != end_after_move_generation; move++)
+    {
+        const bool is_legal = IsLegal(position, check_state, *move);
+        const Bitboard extras_before_move = position.MakeMove(*move);
+        const bool is_king_in_check = position.IsKingInCheck(position.GetDefendingSide());
+        ASSERT_NE(is_legal, is_king_in_check) << ToString(*move) << " leading to " << FenFromPosition(position);
+        if (is_legal)
+        {
+            ExpectIsLegalEqualsKingNotInCheckAfterMove(position, NextMoveList(end_before_move_generation), depth - 1);
+        }
+        position.UnmakeMove(*move, extras_before_move);
+    }
+}
+
+class CheckStateLegalityTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(CheckStateLegalityTest, GivenAllMovesToDepth3_ExpectIsLegalExactlyIfKingNotInCheckAfterMove)
+{
+    Position position{PositionFromFen(GetParam())};
+    MoveStack move_stack{};
+
+    ExpectIsLegalEqualsKingNotInCheckAfterMove(position, move_stack.begin(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousPositions,
+                         CheckStateLegalityTest,
+                         testing::Values(kStandardStartingPosition,
+                                         "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                                         "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                                         "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                                         "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                                         "8/8/8/2k5/3Pp3/8/8/4K2Q b - d3 0 1"));
+
+/// Compares the legal moves generated with the check state with the pseudo legal moves IsLegal lets pass.
+template <typename GenerateBehavior>
+void ExpectLegalMovesEqualPseudoLegalMovesPassingIsLegal(Position& position,
+                                                         const MoveStack::iterator end_before_move_generation,
+                                                         const std::size_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    const CheckState check_state = ComputeCheckState(position);
+    const MoveStack::iterator end_after_pseudo_legal_moves =
+        GenerateMoves<GenerateBehavior>(position, end_before_move_generation);
+    const MoveStack::iterator end_after_filtering =
+        std::remove_if(end_before_move_generation, end_after_pseudo_legal_moves, [&](const Bitmove move) {
+            return !IsLegal(position, check_state, move);
+        });
+    const std::vector<Bitmove> expected_moves{end_before_move_generation, end_after_filtering};
+
+    const MoveStack::iterator end_after_move_generation =
+        GenerateMoves<GenerateBehavior>(position, check_state, end_before_move_generation);
+    const std::vector<Bitmove> legal_moves{end_before_move_generation, end_after_move_generation};
+    ASSERT_EQ(legal_moves, expected_moves) << FenFromPosition(position);
+
+    for (const Bitmove move : legal_moves)
+    {
+        const Bitboard extras_before_move = position.MakeMove(move);
+        ExpectLegalMovesEqualPseudoLegalMovesPassingIsLegal<GenerateBehavior>(
+            position, NextMoveList(end_before_move_generation), depth - 1);
+        position.UnmakeMove(move, extras_before_move);
+    }
+}
+
+class GenerateLegalMovesTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(GenerateLegalMovesTest, GivenAllMovesToDepth3_ExpectPseudoLegalMovesPassingIsLegal)
+{
+    Position position{PositionFromFen(GetParam())};
+    MoveStack move_stack{};
+
+    ExpectLegalMovesEqualPseudoLegalMovesPassingIsLegal<GenerateAllPseudoLegalMoves>(position, move_stack.begin(), 3);
+    ExpectLegalMovesEqualPseudoLegalMovesPassingIsLegal<GenerateAllPseudoLegalMovesWithKoggeStoneSliders>(
+        position, move_stack.begin(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousPositions,
+                         GenerateLegalMovesTest,
+                         testing::Values(kStandardStartingPosition,
+                                         "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                                         "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                                         "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                                         "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                                         "8/8/8/2k5/3Pp3/8/8/4K2Q b - d3 0 1",
+                                         "8/8/8/K2Pp2r/8/8/8/7k w - e6 0 1",
+                                         "4k3/8/8/8/8/5n2/8/r3K2R w K - 0 1"));
+
+TEST(GenerateLegalMovesTest, GivenDoubleCheck_ExpectOnlyKingMoves)
+{
+    const Position position{PositionFromFen("4k3/8/8/8/8/5n2/3Q4/r3K3 w - - 0 1")};
+    MoveStack move_stack{};
+
+    const MoveStack::iterator end =
+        GenerateMoves<GenerateAllPseudoLegalMoves>(position, ComputeCheckState(position), move_stack.begin());
+
+    ASSERT_NE(end, move_stack.begin());
+    EXPECT_TRUE(
+        std::all_of(move_stack.begin(), end, [](const Bitmove move) { return ExtractMovedPiece(move) == kKing; }));
+}
+
+TEST(GenerateLegalMovesTest, GivenEnPassantCaptureUncoveringRook_ExpectNoEnPassantCapture)
+{
+    const Position position{PositionFromFen("8/8/8/K2Pp2r/8/8/8/7k w - e6 0 1")};
+    MoveStack move_stack{};
+
+    const MoveStack::iterator end =
+        GenerateMoves<GenerateAllPseudoLegalMoves>(position, ComputeCheckState(position), move_stack.begin());
+
+    EXPECT_TRUE(std::none_of(move_stack.begin(), end, [](const Bitmove move) {
+        return (move & kMoveMaskType) == kMoveTypeEnPassantCapture;
+    }));
+}
+
+TEST(CheckStateTest, GivenPinnedKnightAndCheckingPawn_ExpectPinnedPiecesAndCheckers)
+{
+    const CheckState check_state = ComputeCheckState(PositionFromFen("4r3/8/8/8/8/4N3/3p4/4K3 w - - 0 1"));
+
+    EXPECT_EQ(check_state.checkers, D2);
+    EXPECT_EQ(check_state.pinned_pieces, E3);
+    EXPECT_EQ(check_state.check_evasion_squares, D2);
+    EXPECT_TRUE(check_state.king_danger_squares & (C1 | E1 | E2));
+}
+
+TEST(CheckStateTest, GivenCheckingRook_ExpectSquaresBehindKingAreDangerous)
+{
+    const CheckState check_state = ComputeCheckState(PositionFromFen("4k3/8/8/8/8/8/8/r3K3 w - - 0 1"));
+
+    EXPECT_EQ(check_state.checkers, A1);
+    EXPECT_EQ(check_state.check_evasion_squares, A1 | B1 | C1 | D1);
+    EXPECT_TRUE(check_state.king_danger_squares & F1);
+    EXPECT_FALSE(check_state.king_danger_squares & E2);
+}
+
+TEST(CheckStateTest, GivenNoCheck_ExpectNotInCheck)
+{
+    const CheckState check_state = ComputeCheckState(PositionFromFen(kStandardStartingPosition));
+
+    EXPECT_FALSE(check_state.IsInCheck());
+    EXPECT_EQ(check_state.pinned_pieces, Bitboard{0});
+}
+
+}  // namespace
+}  // namespace Chess
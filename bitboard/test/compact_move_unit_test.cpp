@@ -0,0 +1,90 @@
+#include "bitboard/compact_move.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/squares.h"
+#include "bitboard/uci_conversion.h"
+#include "hardware/trailing_zeros_count.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace Chess
+{
+namespace
+{
+
+static_assert(sizeof(CompactMove) == 2, "Compact move is expected to take only two bytes.");
+
+/// Restores each move from its compact form in the position it is played in, down to the given depth.
+void ExpectToBitmoveRestoresCompactedMove(Position& position,
+                                          const MoveStack::iterator end_before_move_generation,
+                                          const std::size_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    const MoveStack::iterator end_after_move_generation = GenerateMoves(position, end_before_move_generation);
+    for (auto move = end_before_move_generation; move != end_after_move_generation; move++)
+    {
+        const CompactMove compact_move = ToCompactMove(*move);
+        ASSERT_EQ(ToBitmove(position, compact_move), *move) << ToString(*move) << " in " << FenFromPosition(position);
+        ASSERT_EQ(ToUciString(compact_move), ToUciString(*move));
+
+        const Bitboard extras_before_move = position.MakeMove(*move);
+        ExpectToBitmoveRestoresCompactedMove(position, NextMoveList(end_before_move_generation), depth - 1);
+        position.UnmakeMove(*move, extras_before_move);
+    }
+}
+
+class CompactMoveTestFixture : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(CompactMoveTestFixture, GivenAllMovesDownToDepth3_ExpectCompactMoveRestored)
+{
+    Position position = PositionFromFen(GetParam());
+    MoveStack move_stack{};
+    ExpectToBitmoveRestoresCompactedMove(position, move_stack.begin(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    VariousPositions,
+    CompactMoveTestFixture,
+    ::testing::Values(kStandardStartingPosition,
+                      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+
+TEST(CompactMoveTest, GivenNullMove_ExpectNullMove)
+{
+    const Position position = PositionFromFen(kStandardStartingPosition);
+    EXPECT_EQ(ToCompactMove(kBitNullMove), kCompactNullMove);
+    EXPECT_EQ(ToBitmove(position, kCompactNullMove), kBitNullMove);
+    EXPECT_EQ(ToUciString(kCompactNullMove), kUciNullMove);
+}
+
+TEST(CompactMoveTest, GivenPromotionCapture_ExpectPromotedPieceInUciString)
+{
+    const Bitmove move = ComposeMove(tzcnt(B7), tzcnt(A8), kPawn, kRook, kQueen, kMoveTypePromotion);
+    const CompactMove compact_move = ToCompactMove(move);
+    EXPECT_EQ(ToUciString(compact_move), "b7a8q");
+    EXPECT_EQ(ToUciString(ScoredMove{move, 0}), "b7a8q");
+}
+
+TEST(ScoredMoveTest, GivenMovesSortedByIsScoreGreater_ExpectBestMoveFirst)
+{
+    std::array<ScoredMove, 3> moves{ScoredMove{1, -5}, ScoredMove{2, 20}, ScoredMove{3, 0}};
+    std::sort(moves.begin(), moves.end(), IsScoreGreater);
+    EXPECT_EQ(moves[0].move, 2);
+    EXPECT_EQ(moves[1].move, 3);
+    EXPECT_EQ(moves[2].move, 1);
+}
+
+}  // namespace
+}  // namespace Chess
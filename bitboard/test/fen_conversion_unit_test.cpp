@@ -59,7 +59,7 @@ Position StandardStartingPosition()
 {
     Position position{};
     position[kExtrasBoard] = kBoardMaskCastling;
-    position.white_to_move_ = true;
+    position.SetWhiteToMove(true);
 
     // white pieces
     position[kWhiteBoard] = kRank2 | kRank1;
@@ -79,6 +79,7 @@ Position StandardStartingPosition()
     position[kBlackBoard + kQueen] = D8;
     position[kBlackBoard + kKing] = E8;
 
+    position.UpdateOccupiedSquares();
     return position;
 }
 
@@ -0,0 +1,139 @@
+#include "bitboard/check_state.h"
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/lookup_table/piece.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/uci_conversion.h"
+#include "hardware/trailing_zeros_count.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace
+{
+
+/// Quiet checks the slow way: all pseudo legal moves which are neither capture nor promotion, played to see whether
+/// the opposing king is in check afterwards. (Apart from the king stepping next to the opposing king, which is never
+/// legal and no check in the sense of the generator.)
+std::set<Bitmove> FindQuietChecksByFullGeneration(const Position& position, const MoveStack::iterator begin)
+{
+    const Bitboard next_to_opposing_king = kKingAttacks[tzcnt(position[position.GetDefendingSide() + kKing])];
+    std::set<Bitmove> quiet_checks{};
+    const MoveStack::iterator end = GenerateMoves<GenerateAllPseudoLegalMoves>(position, begin);
+    for (auto move = begin; move != end; move++)
+    {
+        if (ExtractCapturedPiece(*move) || ((*move & kMoveMaskType) == kMoveTypePromotion))
+        {
+            continue;
+        }
+        if ((ExtractMovedPiece(*move) == kKing) && ((Bitboard{1} << ExtractTarget(*move)) & next_to_opposing_king))
+        {
+            continue;
+        }
+        Position position_after_move{position};
+        position_after_move.MakeMove(*move);
+        if (ComputeCheckState(position_after_move).IsInCheck())
+        {
+            quiet_checks.insert(*move);
+        }
+    }
+    return quiet_checks;
+}
+
+std::vector<Bitmove> GenerateQuietChecks(const Position& position, const MoveStack::iterator begin)
+{
+    const MoveStack::iterator end = GenerateMoves<Chess::GenerateQuietChecks>(position, begin);
+    return {begin, end};
+}
+
+std::set<std::string> ToUciStrings(const std::vector<Bitmove>& moves)
+{
+    std::set<std::string> uci_strings{};
+    for (const Bitmove move : moves)
+    {
+        uci_strings.insert(ToUciString(move));
+    }
+    return uci_strings;
+}
+
+class QuietChecksTestFixture : public ::testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(QuietChecksTestFixture, GivenPositionsOfRandomGames_ExpectSameQuietChecksAsFullGeneration)
+{
+    constexpr std::size_t number_of_games{20};
+    constexpr std::size_t maximum_number_of_plies{80};
+    std::mt19937 random_number_generator{42};
+    MoveStack move_stack{};
+
+    for (std::size_t game{0}; game < number_of_games; game++)
+    {
+        Position position = PositionFromFen(GetParam());
+        for (std::size_t ply{0}; ply < maximum_number_of_plies; ply++)
+        {
+            const std::vector<Bitmove> quiet_checks = GenerateQuietChecks(position, move_stack.begin());
+            const std::set<Bitmove> unique_quiet_checks{quiet_checks.begin(), quiet_checks.end()};
+            ASSERT_EQ(quiet_checks.size(), unique_quiet_checks.size()) << FenFromPosition(position);
+            ASSERT_EQ(unique_quiet_checks, FindQuietChecksByFullGeneration(position, move_stack.begin()))
+                << FenFromPosition(position);
+
+            const CheckState check_state = ComputeCheckState(position);
+            const MoveStack::iterator end = GenerateMoves(position, move_stack.begin());
+            std::vector<Bitmove> legal_moves{};
+            std::copy_if(move_stack.begin(), end, std::back_inserter(legal_moves), [&](const Bitmove move) {
+                return IsLegal(position, check_state, move);
+            });
+            if (legal_moves.empty())
+            {
+                break;
+            }
+            std::uniform_int_distribution<std::size_t> random_move{0, legal_moves.size() - 1};
+            position.MakeMove(legal_moves.at(random_move(random_number_generator)));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    VariousPositions,
+    QuietChecksTestFixture,
+    ::testing::Values(kStandardStartingPosition,
+                      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                      "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                      "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"));
+
+TEST(QuietChecksTest, GivenKnightBetweenRookAndKing_ExpectEveryKnightMoveUncoversCheck)
+{
+    const Position position = PositionFromFen("4k3/8/8/8/8/8/4N3/4RK2 w - - 0 1");
+    MoveStack move_stack{};
+    const std::set<std::string> expected_quiet_checks{"e2c1", "e2c3", "e2d4", "e2f4", "e2g1", "e2g3"};
+    EXPECT_EQ(ToUciStrings(GenerateQuietChecks(position, move_stack.begin())), expected_quiet_checks);
+}
+
+TEST(QuietChecksTest, GivenRookCheckAfterCastling_ExpectCastlingAmongQuietChecks)
+{
+    const Position position = PositionFromFen("5k2/8/8/8/8/8/8/4K2R w K - 0 1");
+    MoveStack move_stack{};
+    const std::set<std::string> expected_quiet_checks{"e1g1", "h1f1", "h1h8"};
+    EXPECT_EQ(ToUciStrings(GenerateQuietChecks(position, move_stack.begin())), expected_quiet_checks);
+}
+
+TEST(QuietChecksTest, GivenRookNotCheckingAfterCastling_ExpectCastlingNotAmongQuietChecks)
+{
+    const Position position = PositionFromFen("6k1/8/8/8/8/8/8/4K2R w K - 0 1");
+    MoveStack move_stack{};
+    const std::set<std::string> expected_quiet_checks{"h1g1", "h1h8"};
+    EXPECT_EQ(ToUciStrings(GenerateQuietChecks(position, move_stack.begin())), expected_quiet_checks);
+}
+
+}  // namespace
+}  // namespace Chess
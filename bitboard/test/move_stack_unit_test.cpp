@@ -0,0 +1,33 @@
+#include "bitboard/move_stack.h"
+
+#include <gtest/gtest.h>
+
+namespace Chess
+{
+namespace
+{
+
+TEST(MoveStackTest, GivenMoveListOfEveryPly_ExpectInsideMoveStack)
+{
+    MoveStack move_stack{};
+    MoveStack::iterator begin_of_move_list = move_stack.begin();
+    for (std::size_t ply{1}; ply < kNumberOfMoveLists; ply++)
+    {
+        begin_of_move_list = NextMoveList(begin_of_move_list);
+        EXPECT_EQ(begin_of_move_list, move_stack.begin() + ply * kMoveListCapacity);
+    }
+    EXPECT_EQ(begin_of_move_list + kMoveListCapacity, move_stack.end());
+    EXPECT_EQ(*move_stack.end(), kEndOfMoveStack);
+}
+
+#ifndef NDEBUG
+TEST(MoveStackDeathTest, GivenMoveListOfLastPly_ExpectNoNextMoveList)
+{
+    MoveStack move_stack{};
+    const MoveStack::iterator begin_of_last_move_list = move_stack.end() - kMoveListCapacity;
+    EXPECT_DEATH(std::ignore = NextMoveList(begin_of_last_move_list), "");
+}
+#endif
+
+}  // namespace
+}  // namespace Chess
@@ -1,4 +1,5 @@
 ﻿#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
 #include "bitboard/position.h"
 #include "bitboard/squares.h"
 #include "hardware/trailing_zeros_count.h"
@@ -24,7 +25,7 @@ TEST(BoardIndxesTest, GivenUniqueNumberToEachBitboard_ExpectRespectiveUniqueNumb
     unit.boards_[kBlackBoard + kRook] = 6;
     unit.boards_[kBlackBoard + kQueen] = 7;
     unit.boards_[kBlackBoard + kKing] = 8;
-    unit.boards_[kUnused1Board] = 9;
+    unit.boards_[kOccupiedBoard] = 9;
     unit.boards_[kWhiteBoard] = 10;
     unit.boards_[kWhiteBoard + kPawn] = 11;
     unit.boards_[kWhiteBoard + kKnight] = 12;
@@ -32,7 +33,6 @@ TEST(BoardIndxesTest, GivenUniqueNumberToEachBitboard_ExpectRespectiveUniqueNumb
     unit.boards_[kWhiteBoard + kRook] = 14;
     unit.boards_[kWhiteBoard + kQueen] = 15;
     unit.boards_[kWhiteBoard + kKing] = 16;
-    unit.boards_[kUnused2Board] = 17;
 
     Bitboard expected_unique_number = 1;
     for (Bitboard board : unit.boards_)
@@ -82,5 +82,26 @@ TEST(MakeUnmakeMoveTest, GivenArbitraryMove_ExpectTotalPliesCountIncremented)
     EXPECT_EQ(total_plies_original, total_plies_after_unmake);
 }
 
+TEST(MakeUnmakeMoveTest, GivenAllMoves_ExpectSideToMoveAndOccupiedSquaresUpdatedAndRestored)
+{
+    const Position original_position =
+        PositionFromFen("r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1");
+    Position position{original_position};
+    MoveStack move_stack{};
+    const auto end_after_move_generation = GenerateMoves(position, move_stack.begin());
+
+    for (auto move = move_stack.begin(); move != end_after_move_generation; move++)
+    {
+        const Bitboard saved_extras = position.MakeMove(*move);
+        EXPECT_FALSE(position.IsWhiteToMove());
+        EXPECT_EQ(position.GetAttackingSide(), kBlackBoard);
+        EXPECT_EQ(position.GetDefendingSide(), kWhiteBoard);
+        EXPECT_EQ(position[kOccupiedBoard], position[kBlackBoard] | position[kWhiteBoard]);
+
+        position.UnmakeMove(*move, saved_extras);
+        EXPECT_EQ(position, original_position) << ToString(*move);
+    }
+}
+
 }  // namespace
 }  // namespace Chess
@@ -0,0 +1,128 @@
+#include "bitboard/pseudo_legality.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/uci_conversion.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace
+{
+
+Bitmove FindMove(const Position& position, const std::string& uci_move)
+{
+    MoveStack move_stack{};
+    const auto end = GenerateMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+    const auto move = std::find_if(
+        move_stack.begin(), end, [&uci_move](const auto move) { return ToUciString(move) == uci_move; });
+    return move == end ? kBitNullMove : *move;
+}
+
+class PseudoLegalityFuzzTest : public testing::TestWithParam<std::string>
+{
+};
+
+/// Plays random games and checks every known and a number of random moves against the moves of the generator.
+TEST_P(PseudoLegalityFuzzTest, GivenRandomPositions_ExpectPseudoLegalExactlyIfGenerated)
+{
+    constexpr std::size_t kNumberOfGames{20};
+    constexpr std::size_t kMaximumPliesPerGame{80};
+    constexpr std::size_t kRandomMovesPerPosition{200};
+    std::mt19937 random_number_generator{42};
+    std::set<Bitmove> known_moves{};
+    MoveStack move_stack{};
+
+    for (std::size_t game{0}; game < kNumberOfGames; game++)
+    {
+        Position position{PositionFromFen(GetParam())};
+        for (std::size_t ply{0}; ply < kMaximumPliesPerGame; ply++)
+        {
+            const auto end = GenerateMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+            const std::set<Bitmove> generated_moves{move_stack.begin(), end};
+            known_moves.insert(generated_moves.begin(), generated_moves.end());
+
+            const auto expect_pseudo_legal_exactly_if_generated = [&](const Bitmove move) {
+                ASSERT_EQ(IsPseudoLegal(position, move), generated_moves.count(move) == 1)
+                    << ToString(move) << " in " << FenFromPosition(position);
+            };
+            for (const Bitmove move : known_moves)
+            {
+                expect_pseudo_legal_exactly_if_generated(move);
+            }
+            for (std::size_t count{0}; count < kRandomMovesPerPosition; count++)
+            {
+                expect_pseudo_legal_exactly_if_generated(random_number_generator() & ~kMoveMaskUnused);
+            }
+
+            // play a random legal move
+            std::vector<Bitmove> legal_moves{};
+            for (const Bitmove move : generated_moves)
+            {
+                const Bitboard extras_before_move = position.MakeMove(move);
+                if (!position.IsKingInCheck(position.GetDefendingSide()))
+                {
+                    legal_moves.push_back(move);
+                }
+                position.UnmakeMove(move, extras_before_move);
+            }
+            if (legal_moves.empty())
+            {
+                break;
+            }
+            position.MakeMove(legal_moves[random_number_generator() % legal_moves.size()]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousPositions,
+                         PseudoLegalityFuzzTest,
+                         testing::Values(kStandardStartingPosition,
+                                         "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                                         "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+                                         "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+                                         "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+
+TEST(PseudoLegalityTest, GivenMoveOfOpponentsPiece_ExpectNotPseudoLegal)
+{
+    const Bitmove move = FindMove(PositionFromFen(kStandardStartingPosition), "e2e4");
+
+    EXPECT_TRUE(IsPseudoLegal(PositionFromFen(kStandardStartingPosition), move));
+    EXPECT_FALSE(IsPseudoLegal(PositionFromFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR b KQkq - 0 1"), move));
+}
+
+TEST(PseudoLegalityTest, GivenSliderBlocked_ExpectNotPseudoLegal)
+{
+    const Bitmove move = FindMove(PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 0 1"), "a1a8");
+
+    EXPECT_TRUE(IsPseudoLegal(PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 0 1"), move));
+    EXPECT_FALSE(IsPseudoLegal(PositionFromFen("4k3/8/8/8/P7/8/8/R3K3 w - - 0 1"), move));
+}
+
+TEST(PseudoLegalityTest, GivenCastlingRightLostOrPathOccupied_ExpectNotPseudoLegal)
+{
+    const Bitmove move = FindMove(PositionFromFen("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1"), "e1c1");
+
+    EXPECT_TRUE(IsPseudoLegal(PositionFromFen("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1"), move));
+    EXPECT_FALSE(IsPseudoLegal(PositionFromFen("r3k2r/8/8/8/8/8/8/R3K2R w Kkq - 0 1"), move));
+    EXPECT_FALSE(IsPseudoLegal(PositionFromFen("r3k2r/8/8/8/8/8/8/RN2K2R w KQkq - 0 1"), move));
+}
+
+TEST(PseudoLegalityTest, GivenEnPassantSquareGone_ExpectNotPseudoLegal)
+{
+    const Bitmove move = FindMove(PositionFromFen("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1"), "e5d6");
+
+    EXPECT_TRUE(IsPseudoLegal(PositionFromFen("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1"), move));
+    EXPECT_FALSE(IsPseudoLegal(PositionFromFen("4k3/8/8/3pP3/8/8/8/4K3 w - - 0 1"), move));
+}
+
+}  // namespace
+}  // namespace Chess
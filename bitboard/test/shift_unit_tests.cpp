@@ -54,6 +54,14 @@ INSTANTIATE_TEST_SUITE_P(AllCornersAndDirections,
                                          E4_step_in_all_directions,
                                          D8_step_in_all_directions));
 
+TEST(SingleStepTest, GivenSeveralSquares_ExpectAllStepAtOnceAndWrappingOnesDropped)
+{
+    EXPECT_EQ(SingleStep(A2 | E2 | H2, kNorthWest), D3 | G3);
+    EXPECT_EQ(SingleStep(A7 | E7 | H7, kSouthEast), B6 | F6);
+    EXPECT_EQ(SingleStep(kRank2, kNorth), kRank3);
+    EXPECT_EQ(SingleStep(kRank8 | E4, kNorth), E5);
+}
+
 struct KnightJumpTestParameter
 {
     Bitboard source;
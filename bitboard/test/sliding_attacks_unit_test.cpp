@@ -0,0 +1,132 @@
+#include "bitboard/sliding_attacks.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/shift.h"
+#include "bitboard/squares.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace
+{
+
+/// Walks every ray square by square, like the ray style move generation.
+Bitboard SlidingAttacksByWalkingRays(const Bitboard rook_sliders,
+                                     const Bitboard bishop_sliders,
+                                     const Bitboard occupied_squares)
+{
+    Bitboard attacks{0};
+    const auto walk_rays = [&](const Bitboard sliders, const std::array<std::size_t, 4>& directions) {
+        for (Bitboard remaining_sliders = sliders; remaining_sliders; remaining_sliders &= remaining_sliders - 1)
+        {
+            for (const auto direction : directions)
+            {
+                Bitboard square = SingleStep(remaining_sliders & -remaining_sliders, direction);
+                while (square)
+                {
+                    attacks |= square;
+                    if (square & occupied_squares)
+                    {
+                        break;
+                    }
+                    square = SingleStep(square, direction);
+                }
+            }
+        }
+    };
+    walk_rays(rook_sliders, rook_directions);
+    walk_rays(bishop_sliders, bishop_directions);
+    return attacks;
+}
+
+TEST(SlidingAttacksTest, GivenRookWithBlocker_ExpectAttacksUpToAndIncludingBlocker)
+{
+    EXPECT_EQ(SlidingAttacks(A1, 0, A1 | A4 | E1), A2 | A3 | A4 | B1 | C1 | D1 | E1);
+    EXPECT_EQ(SlidingAttacksPortable(A1, 0, A1 | A4 | E1), A2 | A3 | A4 | B1 | C1 | D1 | E1);
+}
+
+TEST(SlidingAttacksTest, GivenBishopInCorner_ExpectWholeDiagonalWithoutWrapping)
+{
+    EXPECT_EQ(SlidingAttacks(0, H1, H1), G2 | F3 | E4 | D5 | C6 | B7 | A8);
+    EXPECT_EQ(SlidingAttacksPortable(0, H1, H1), G2 | F3 | E4 | D5 | C6 | B7 | A8);
+}
+
+TEST(SlidingAttacksTest, GivenRandomSlidersAndBlockers_ExpectSameAttacksAsWalkingRays)
+{
+    std::mt19937_64 random_number_generator{42};
+    for (int sample{0}; sample < 10000; sample++)
+    {
+        // sparse boards, like in actual positions
+        const Bitboard rook_sliders = random_number_generator() & random_number_generator() & random_number_generator();
+        const Bitboard bishop_sliders =
+            random_number_generator() & random_number_generator() & random_number_generator();
+        const Bitboard occupied_squares =
+            (random_number_generator() & random_number_generator()) | rook_sliders | bishop_sliders;
+
+        const Bitboard expected_attacks = SlidingAttacksByWalkingRays(rook_sliders, bishop_sliders, occupied_squares);
+        ASSERT_EQ(SlidingAttacksPortable(rook_sliders, bishop_sliders, occupied_squares), expected_attacks);
+#ifdef __AVX2__
+        ASSERT_EQ(SlidingAttacksAvx2(rook_sliders, bishop_sliders, occupied_squares), expected_attacks);
+#endif
+    }
+}
+
+/// Compares the moves of both slider backends for all positions down to the given depth.
+void ExpectSameMovesWithKoggeStoneSliders(Position& position,
+                                          const MoveStack::iterator end_before_move_generation,
+                                          const std::size_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    const MoveStack::iterator end_after_move_generation =
+        GenerateMoves<GenerateAllPseudoLegalMoves>(position, end_before_move_generation);
+    std::vector<Bitmove> moves{end_before_move_generation, end_after_move_generation};
+    const MoveStack::iterator end_after_kogge_stone_move_generation =
+        GenerateMoves<GenerateAllPseudoLegalMovesWithKoggeStoneSliders>(position, end_before_move_generation);
+    std::vector<Bitmove> kogge_stone_moves{end_before_move_generation, end_after_kogge_stone_move_generation};
+    std::sort(moves.begin(), moves.end());
+    std::sort(kogge_stone_moves.begin(), kogge_stone_moves.end());
+    ASSERT_EQ(moves, kogge_stone_moves) << FenFromPosition(position);
+
+    for (const Bitmove move : moves)
+    {
+        const Bitboard extras_before_move = position.MakeMove(move);
+        if (!position.IsKingInCheck(position.GetDefendingSide()))
+        {
+            ExpectSameMovesWithKoggeStoneSliders(position, NextMoveList(end_before_move_generation), depth - 1);
+        }
+        position.UnmakeMove(move, extras_before_move);
+    }
+}
+
+class KoggeStoneSlidersMoveGenerationTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(KoggeStoneSlidersMoveGenerationTest, GivenAllPositionsToDepth3_ExpectSameMovesAsRayStyleGeneration)
+{
+    Position position{PositionFromFen(GetParam())};
+    MoveStack move_stack{};
+
+    ExpectSameMovesWithKoggeStoneSliders(position, move_stack.begin(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousPositions,
+                         KoggeStoneSlidersMoveGenerationTest,
+                         testing::Values(kStandardStartingPosition,
+                                         "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                                         "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                                         "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"));
+
+}  // namespace
+}  // namespace Chess
@@ -47,5 +47,16 @@ INSTANTIATE_TEST_SUITE_P(AllSquares, SquareTestFixture, testing::Values(kAllSqua
 INSTANTIATE_TEST_SUITE_P(AllRanks, SquareTestFixture, testing::Values(kAllRanks));
 INSTANTIATE_TEST_SUITE_P(AllFiles, SquareTestFixture, testing::Values(kAllFiles));
 
+TEST(SquareColorTest, GivenCornersAndNeighbours_ExpectColorsOfTheBoard)
+{
+    EXPECT_TRUE(H1 & kLightSquares);
+    EXPECT_TRUE(A8 & kLightSquares);
+    EXPECT_TRUE(A1 & kDarkSquares);
+    EXPECT_TRUE(H8 & kDarkSquares);
+    EXPECT_TRUE(B1 & kLightSquares);
+    EXPECT_TRUE(A2 & kLightSquares);
+    EXPECT_EQ(kLightSquares ^ kDarkSquares, std::numeric_limits<Bitboard>::max());
+}
+
 }  // namespace
 }  // namespace Chess
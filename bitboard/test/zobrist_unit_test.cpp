@@ -0,0 +1,80 @@
+#include "bitboard/zobrist.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/uci_conversion.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace Chess
+{
+namespace
+{
+
+/// Plays all pseudo-legal moves down to the given depth and compares the updated key with the one from scratch.
+void ExpectUpdatedKeysEqualComputedKeys(Position& position,
+                                        const ZobristKey key,
+                                        const MoveStack::iterator end_before_move_generation,
+                                        const std::size_t depth)
+{
+    if (depth == 0)
+    {
+        return;
+    }
+    const MoveStack::iterator end_after_move_generation =
+        GenerateMoves<GenerateAllPseudoLegalMoves>(position, end_before_move_generation);
+    for (auto move = end_before_move_generation; move != end_after_move_generation; move++)
+    {
+        const Bitboard extras_before_move = position.MakeMove(*move);
+        const ZobristKey updated_key = UpdateZobristKey(key, *move, extras_before_move, position);
+        ASSERT_EQ(updated_key, ComputeZobristKey(position))
+            << ToUciString(*move) << " leading to " << FenFromPosition(position);
+        ExpectUpdatedKeysEqualComputedKeys(position, updated_key, NextMoveList(end_before_move_generation), depth - 1);
+        position.UnmakeMove(*move, extras_before_move);
+    }
+}
+
+class ZobristKeyUpdateTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(ZobristKeyUpdateTest, GivenAllMovesToDepth3_ExpectUpdatedKeyEqualsKeyComputedFromScratch)
+{
+    // Setup
+    Position position{PositionFromFen(GetParam())};
+    MoveStack move_stack{};
+
+    // Call & Expect
+    ExpectUpdatedKeysEqualComputedKeys(position, ComputeZobristKey(position), move_stack.begin(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousPositions,
+                         ZobristKeyUpdateTest,
+                         testing::Values(kStandardStartingPosition,
+                                         "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                                         "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+                                         "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3"));
+
+TEST(ZobristKeyTest, GivenSamePositionByTransposition_ExpectSameKey)
+{
+    const Position position{PositionFromFen("rnbqkb1r/pppppppp/5n2/8/8/5N2/PPPPPPPP/RNBQKB1R w KQkq - 2 2")};
+    const Position transposed_position{
+        PositionFromFen("rnbqkb1r/pppppppp/5n2/8/8/5N2/PPPPPPPP/RNBQKB1R w KQkq - 6 4")};
+
+    EXPECT_EQ(ComputeZobristKey(position), ComputeZobristKey(transposed_position));
+}
+
+TEST(ZobristKeyTest, GivenDifferenceInSideToMoveCastlingOrEnPassant_ExpectDifferentKeys)
+{
+    const ZobristKey key = ComputeZobristKey(PositionFromFen("r3k2r/8/8/3pP3/8/8/8/R3K2R w KQkq - 0 1"));
+
+    EXPECT_NE(key, ComputeZobristKey(PositionFromFen("r3k2r/8/8/3pP3/8/8/8/R3K2R b KQkq - 0 1")));
+    EXPECT_NE(key, ComputeZobristKey(PositionFromFen("r3k2r/8/8/3pP3/8/8/8/R3K2R w Kkq - 0 1")));
+    EXPECT_NE(key, ComputeZobristKey(PositionFromFen("r3k2r/8/8/3pP3/8/8/8/R3K2R w KQkq d6 0 1")));
+}
+
+}  // namespace
+}  // namespace Chess
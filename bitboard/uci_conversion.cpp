@@ -28,4 +28,29 @@ std::string ToUciString(const Bitmove move)
     return uci_move.str();
 }
 
+std::string ToUciString(const CompactMove move)
+{
+    if (move == kCompactNullMove)
+    {
+        return kUciNullMove;
+    }
+
+    std::stringstream uci_move{};
+    uci_move << kSquareLabels.at(move & kCompactMoveMaskSource)
+             << kSquareLabels.at((move & kCompactMoveMaskTarget) >> kCompactMoveShiftTarget);
+
+    const CompactMove flags = move >> kCompactMoveShiftFlags;
+    if (flags & kCompactMoveFlagPromotion)
+    {
+        uci_move << kPieceLabels.at(kKnight + (flags & kCompactMoveMaskPromotion));
+    }
+
+    return uci_move.str();
+}
+
+std::string ToUciString(const ScoredMove& move)
+{
+    return ToUciString(move.move);
+}
+
 }  // namespace Chess
\ No newline at end of file
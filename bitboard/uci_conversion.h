@@ -2,6 +2,7 @@
 #define BITBOARD_UCI_CONVERSION_H
 
 #include "bitboard/basic_type_declarations.h"
+#include "bitboard/compact_move.h"
 
 #include <string>
 
@@ -11,6 +12,8 @@ namespace Chess
 constexpr const char* const kUciNullMove = "0000";
 
 std::string ToUciString(const Bitmove move);
+std::string ToUciString(const CompactMove move);
+std::string ToUciString(const ScoredMove& move);
 
 }  // namespace Chess
 
@@ -0,0 +1,123 @@
+#ifndef BITBOARD_ZOBRIST_H
+#define BITBOARD_ZOBRIST_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/board.h"
+#include "bitboard/move.h"
+#include "bitboard/pieces.h"
+#include "bitboard/position.h"
+#include "bitboard/squares.h"
+#include "hardware/trailing_zeros_count.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Chess
+{
+
+/// @brief Hash of a position, identical for positions with equal pieces, side to move, castling rights and en passant.
+using ZobristKey = uint64_t;
+
+/// @brief Pseudo random numbers (splitmix64) generated at compile time for reproducible keys.
+constexpr ZobristKey GenerateZobristKey(ZobristKey& state)
+{
+    state += 0x9E3779B97F4A7C15;
+    ZobristKey key = state;
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EB;
+    return key ^ (key >> 31);
+}
+
+using ZobristBoardKeys = std::array<std::array<ZobristKey, 64>, 17>;
+
+constexpr ZobristBoardKeys GenerateZobristBoardKeys()
+{
+    ZobristKey state{0};
+    ZobristBoardKeys keys{};
+    for (auto& board_keys : keys)
+    {
+        for (auto& key : board_keys)
+        {
+            key = GenerateZobristKey(state);
+        }
+    }
+    return keys;
+}
+
+/// Keys for a piece on a square, indexed like the boards of Position, e.g. kZobristBoardKeys[kWhiteBoard + kPawn][8].
+/// The keys of the extras board stand for castling rights and en passant squares (see kZobristExtrasMask).
+constexpr ZobristBoardKeys kZobristBoardKeys{GenerateZobristBoardKeys()};
+constexpr ZobristKey kZobristWhiteToMoveKey{0x3C6EF372FE94F82A};
+constexpr Bitboard kZobristExtrasMask{kBoardMaskCastling | kBoardMaskEnPassant};
+
+/// @brief Combined keys of all given squares of the given board.
+inline ZobristKey GetZobristKey(const std::size_t board, Bitboard squares)
+{
+    ZobristKey key{0};
+    while (squares)
+    {
+        key ^= kZobristBoardKeys[board][tzcnt(squares)];
+        squares &= squares - 1;
+    }
+    return key;
+}
+
+/// @brief Calculates the key of a position from scratch.
+inline ZobristKey ComputeZobristKey(const Position& position)
+{
+    ZobristKey key = GetZobristKey(kExtrasBoard, position[kExtrasBoard] & kZobristExtrasMask);
+    for (const std::size_t side : {kBlackBoard, kWhiteBoard})
+    {
+        for (std::size_t piece = kPawn; piece <= kKing; piece++)
+        {
+            key ^= GetZobristKey(side + piece, position[side + piece]);
+        }
+    }
+    return position.IsWhiteToMove() ? key ^ kZobristWhiteToMoveKey : key;
+}
+
+/// @brief Calculates the key after a move from the key before.
+///
+/// Yields the same as ComputeZobristKey(position_after_move), but only touches what the move changed.
+inline ZobristKey UpdateZobristKey(ZobristKey key,
+                                   const Bitmove move,
+                                   const Bitboard extras_before_move,
+                                   const Position& position_after_move)
+{
+    const std::size_t moving_side = position_after_move.GetDefendingSide();
+    const std::size_t other_side = position_after_move.GetAttackingSide();
+    const Bitboard source = Bitboard{1} << ExtractSource(move);
+    const Bitboard target = Bitboard{1} << ExtractTarget(move);
+    const std::size_t moved_piece = ExtractMovedPiece(move);
+    const std::size_t captured_piece = ExtractCapturedPiece(move);
+    const std::size_t promotion = ExtractPromotion(move);
+    const Bitmove move_type = move & kMoveMaskType;
+
+    key ^= kZobristWhiteToMoveKey;
+    key ^= GetZobristKey(kExtrasBoard, (extras_before_move ^ position_after_move[kExtrasBoard]) & kZobristExtrasMask);
+    key ^= GetZobristKey(moving_side + moved_piece, source);
+    key ^= GetZobristKey(moving_side + (promotion ? promotion : moved_piece), target);
+    if (captured_piece)
+    {
+        const Bitboard en_passant_victim = (moving_side == kWhiteBoard) ? target >> 8 : target << 8;
+        const Bitboard captured = (move_type == kMoveTypeEnPassantCapture) ? en_passant_victim : target;
+        key ^= GetZobristKey(other_side + captured_piece, captured);
+    }
+
+    switch (move_type)
+    {
+        case kMoveTypeKingsideCastling: {
+            key ^= GetZobristKey(moving_side + kRook, (moving_side == kWhiteBoard) ? (F1 | H1) : (F8 | H8));
+            break;
+        }
+        case kMoveTypeQueensideCastling: {
+            key ^= GetZobristKey(moving_side + kRook, (moving_side == kWhiteBoard) ? (A1 | D1) : (A8 | D8));
+            break;
+        }
+    }
+    return key;
+}
+
+}  // namespace Chess
+
+#endif
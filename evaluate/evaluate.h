@@ -1,19 +1,78 @@
 #ifndef EVALUATE_EVALUATE_H
 #define EVALUATE_EVALUATE_H
 
+#include "bitboard/check_state.h"
 #include "bitboard/position.h"
+#include "bitboard/sliding_attacks.h"
 #include "hardware/population_count.h"
 
 namespace Chess
 {
 
 constexpr Evaluation kNullValue{0};
-constexpr Evaluation kPawnValue{1};
-constexpr Evaluation kKnightValue{3};
-constexpr Evaluation kBishopValue{3};
-constexpr Evaluation kRookValue{5};
-constexpr Evaluation kQueenValue{9};
-constexpr Evaluation kKingValue{100};
+constexpr Evaluation kPawnValue{100};
+constexpr Evaluation kKnightValue{300};
+constexpr Evaluation kBishopValue{300};
+constexpr Evaluation kRookValue{500};
+constexpr Evaluation kQueenValue{900};
+constexpr Evaluation kKingValue{10000};
+
+constexpr Evaluation kDraw{0};
+
+/// Being checkmated evaluates to -kMate plus the plies from the root (in negamax notation), which prefers short mates.
+/// Any evaluation beyond kMateBound is a mate score, any material balance stays below.
+constexpr Evaluation kMate{32000};
+constexpr Evaluation kMateBound{kMate - 1000};
+
+/// Beyond any evaluation (e.g. for the initial alpha/beta window). Unlike the limits of Evaluation it can be negated.
+constexpr Evaluation kInfinity{kMate + 1};
+
+/// @brief Negamax evaluation of giving checkmate at the given ply.
+constexpr Evaluation MateIn(const std::size_t plies)
+{
+    return static_cast<Evaluation>(kMate - static_cast<int>(plies));
+}
+
+/// @brief Negamax evaluation of being checkmated at the given ply.
+constexpr Evaluation MatedIn(const std::size_t plies)
+{
+    return static_cast<Evaluation>(-kMate + static_cast<int>(plies));
+}
+
+constexpr bool IsMateScore(const Evaluation evaluation)
+{
+    return (evaluation >= kMateBound) || (evaluation <= -kMateBound);
+}
+
+/// @brief Makes a mate score relative to the node at the given ply before storing it in a hash table.
+///
+/// Mate scores count the plies from the root, but a hash entry may be found at another ply (or from another root).
+constexpr Evaluation ToHashEvaluation(const Evaluation evaluation, const std::size_t plies)
+{
+    if (evaluation >= kMateBound)
+    {
+        return static_cast<Evaluation>(evaluation + static_cast<int>(plies));
+    }
+    if (evaluation <= -kMateBound)
+    {
+        return static_cast<Evaluation>(evaluation - static_cast<int>(plies));
+    }
+    return evaluation;
+}
+
+/// @brief Inverse of ToHashEvaluation for a hash entry found at the given ply.
+constexpr Evaluation FromHashEvaluation(const Evaluation evaluation, const std::size_t plies)
+{
+    if (evaluation >= kMateBound)
+    {
+        return static_cast<Evaluation>(evaluation - static_cast<int>(plies));
+    }
+    if (evaluation <= -kMateBound)
+    {
+        return static_cast<Evaluation>(evaluation + static_cast<int>(plies));
+    }
+    return evaluation;
+}
 
 struct EvaluateMaterial
 {
@@ -32,13 +91,72 @@ std::enable_if_t<Behaviour::evaluate_material, Evaluation> Evaluate(const Positi
            (popcnt(position[kWhiteBoard + kKing]) - popcnt(position[kBlackBoard + kKing])) * kKingValue;
 }
 
+/// Value of each square that at least one bishop, rook or queen of a side can move to
+constexpr Evaluation kSliderMobilityValue{4};
+
+struct EvaluateMaterialAndMobility
+{
+    static constexpr bool evaluate_material_and_mobility{true};
+};
+
+/// Static evaluation of a position: material plus slider mobility
+///
+/// The moves of all sliders of a side come from a single set-wise fill (see SlidingAttacks) rather than piece by piece.
+template <typename Behaviour>
+std::enable_if_t<Behaviour::evaluate_material_and_mobility, Evaluation> Evaluate(const Position& position)
+{
+    const Bitboard occupied_squares = position[kOccupiedBoard];
+    const auto slider_mobility = [&](const std::size_t side) {
+        const Bitboard queens = position[side + kQueen];
+        const Bitboard slider_attacks =
+            SlidingAttacks(position[side + kRook] | queens, position[side + kBishop] | queens, occupied_squares);
+        return popcnt(slider_attacks & ~position[side]);
+    };
+    const int mobility_difference = slider_mobility(kWhiteBoard) - slider_mobility(kBlackBoard);
+    return static_cast<Evaluation>(Evaluate<EvaluateMaterial>(position) + mobility_difference * kSliderMobilityValue);
+}
+
 /// Function assumes that in the provided position no legal moves are left
 /// Returns the game result in negamax notation.
-inline Evaluation DetermineGameResult(const Position& position, const std::size_t current_depth)
+inline Evaluation DetermineGameResult(const CheckState& check_state, const std::size_t current_depth)
+{
+    return check_state.IsInCheck() ? MatedIn(current_depth) : kDraw;
+}
+
+/// A draw after 50 moves of each side without pawn move or capture.
+constexpr std::size_t kFiftyMoveRulePlies{100};
+
+/// @brief Whether neither side can ever checkmate: K vs K, KB vs K, KN vs K or only bishops on squares of one color.
+inline bool IsInsufficientMaterial(const Position& position)
+{
+    const Bitboard pawns_rooks_and_queens = position[kWhiteBoard + kPawn] | position[kBlackBoard + kPawn] |
+                                            position[kWhiteBoard + kRook] | position[kBlackBoard + kRook] |
+                                            position[kWhiteBoard + kQueen] | position[kBlackBoard + kQueen];
+    if (pawns_rooks_and_queens)
+    {
+        return false;  // quick reject for almost all positions
+    }
+    const Bitboard knights = position[kWhiteBoard + kKnight] | position[kBlackBoard + kKnight];
+    const Bitboard bishops = position[kWhiteBoard + kBishop] | position[kBlackBoard + kBishop];
+    const Bitboard minor_pieces = knights | bishops;
+    if (!(minor_pieces & (minor_pieces - 1)))
+    {
+        return true;  // at most one minor piece
+    }
+    return !knights && (!(bishops & kLightSquares) || !(bishops & kDarkSquares));
+}
+
+/// @brief Whether the game is drawn by the fifty-move rule or by insufficient material, no matter what follows.
+///
+/// A checkmate given by the move completing the fifty moves still counts. So a side in check is left to the search,
+/// which either finds that mate or reaches a drawn position one ply later.
+inline bool IsDrawByRule(const Position& position)
 {
-    constexpr Evaluation negamax_draw = Evaluation{0};
-    constexpr Evaluation negamax_loss = Evaluation{-1000};
-    return position.IsKingInCheck(position.attacking_side_) ? negamax_loss + current_depth : negamax_draw;
+    if ((position.GetStaticPlies() >= kFiftyMoveRulePlies) && !ComputeCheckState(position).IsInCheck())
+    {
+        return true;
+    }
+    return IsInsufficientMaterial(position);
 }
 
 }  // namespace Chess
@@ -1,7 +1,14 @@
 #include "evaluate/evaluate.h"
 
+#include "bitboard/fen_conversion.h"
+#include "bitboard/move.h"
+#include "bitboard/squares.h"
+#include "hardware/trailing_zeros_count.h"
+
 #include <gtest/gtest.h>
 
+#include <string>
+
 namespace Chess
 {
 namespace
@@ -13,52 +20,146 @@ TEST(EvaluateMaterial, GivenSamples_ExpectAllHold)
 
     position[kBlackBoard + kPawn] = 1;
     Evaluation returned_evaluation{Evaluate(position)};
-    EXPECT_FLOAT_EQ(returned_evaluation, -1.0F);
+    EXPECT_EQ(returned_evaluation, -100);
 
     position[kWhiteBoard + kPawn] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, 0.0F);
+    EXPECT_EQ(returned_evaluation, 0);
 
     position[kBlackBoard + kKnight] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, -3.0F);
+    EXPECT_EQ(returned_evaluation, -300);
 
     position[kWhiteBoard + kKnight] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, 0.0F);
+    EXPECT_EQ(returned_evaluation, 0);
 
     position[kBlackBoard + kBishop] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, -3.0F);
+    EXPECT_EQ(returned_evaluation, -300);
 
     position[kWhiteBoard + kBishop] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, 0.0F);
+    EXPECT_EQ(returned_evaluation, 0);
 
     position[kBlackBoard + kRook] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, -5.0F);
+    EXPECT_EQ(returned_evaluation, -500);
 
     position[kWhiteBoard + kRook] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, 0.0F);
+    EXPECT_EQ(returned_evaluation, 0);
 
     position[kBlackBoard + kQueen] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, -9.0F);
+    EXPECT_EQ(returned_evaluation, -900);
 
     position[kWhiteBoard + kQueen] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, 0.0F);
+    EXPECT_EQ(returned_evaluation, 0);
 
     position[kBlackBoard + kKing] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, -100.0F);
+    EXPECT_EQ(returned_evaluation, -10000);
 
     position[kWhiteBoard + kKing] = 1;
     returned_evaluation = Evaluate(position);
-    EXPECT_FLOAT_EQ(returned_evaluation, 0.0F);
+    EXPECT_EQ(returned_evaluation, 0);
 };
 
+TEST(EvaluateMaterialAndMobility, GivenSymmetricPosition_ExpectZero)
+{
+    EXPECT_EQ(Evaluate<EvaluateMaterialAndMobility>(PositionFromFen(kStandardStartingPosition)), 0);
+}
+
+TEST(EvaluateMaterialAndMobility, GivenOpenRook_ExpectMaterialPlusFreeAndCapturableSquares)
+{
+    const Position position{PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 0 1")};
+
+    // a2 to a8 and b1 to d1, but not the own king on e1
+    EXPECT_EQ(Evaluate<EvaluateMaterialAndMobility>(position), kRookValue + 10 * kSliderMobilityValue);
+}
+
+TEST(MateScore, GivenPlies_ExpectMateScoresBeyondMateBoundAndShorterMatesPreferred)
+{
+    EXPECT_EQ(MateIn(1), kMate - 1);
+    EXPECT_EQ(MatedIn(2), -kMate + 2);
+    EXPECT_GT(MateIn(1), MateIn(3));
+    EXPECT_LT(MatedIn(2), MatedIn(4));
+    EXPECT_TRUE(IsMateScore(MateIn(999)));
+    EXPECT_TRUE(IsMateScore(MatedIn(999)));
+    EXPECT_FALSE(IsMateScore(kKingValue + 8 * kQueenValue));
+    EXPECT_FALSE(IsMateScore(-kKingValue - 8 * kQueenValue));
+}
+
+TEST(MateScore, GivenMateFromRoot_ExpectHashEvaluationRelativeToNode)
+{
+    constexpr std::size_t plies_to_node{4};
+    EXPECT_EQ(ToHashEvaluation(MateIn(7), plies_to_node), MateIn(3));
+    EXPECT_EQ(ToHashEvaluation(MatedIn(6), plies_to_node), MatedIn(2));
+    EXPECT_EQ(ToHashEvaluation(Evaluation{-250}, plies_to_node), Evaluation{-250});
+}
+
+TEST(MateScore, GivenHashEvaluationFoundAtOtherPly_ExpectMateFromNewRoot)
+{
+    constexpr std::size_t plies_when_stored{4};
+    constexpr std::size_t plies_when_found{6};
+    EXPECT_EQ(FromHashEvaluation(ToHashEvaluation(MateIn(7), plies_when_stored), plies_when_found), MateIn(9));
+    EXPECT_EQ(FromHashEvaluation(ToHashEvaluation(MatedIn(6), plies_when_stored), plies_when_found), MatedIn(8));
+    EXPECT_EQ(FromHashEvaluation(Evaluation{250}, plies_when_found), Evaluation{250});
+}
+
+class InsufficientMaterialTest : public testing::TestWithParam<std::tuple<std::string, bool>>
+{
+};
+
+TEST_P(InsufficientMaterialTest, GivenMaterial_ExpectDeadPositionsDetected)
+{
+    const Position position{PositionFromFen(std::get<0>(GetParam()))};
+
+    EXPECT_EQ(IsInsufficientMaterial(position), std::get<1>(GetParam()));
+    EXPECT_EQ(IsDrawByRule(position), std::get<1>(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    VariousMaterial,
+    InsufficientMaterialTest,
+    testing::Values(std::make_tuple("4k3/8/8/8/8/8/8/4K3 w - - 0 1", true),           // K vs K
+                    std::make_tuple("4k3/8/8/8/8/8/8/2B1K3 w - - 0 1", true),         // KB vs K
+                    std::make_tuple("4k3/8/8/8/8/8/8/4K1n1 b - - 0 1", true),         // K vs KN
+                    std::make_tuple("2b1k3/8/8/8/8/8/8/3BK3 w - - 0 1", true),        // bishops on light squares
+                    std::make_tuple("4kb2/8/8/8/8/8/8/2B1K3 w - - 0 1", true),        // bishops on dark squares
+                    std::make_tuple("2b1k3/8/8/8/8/8/8/2B1K3 w - - 0 1", false),      // bishops of opposite colors
+                    std::make_tuple("4k3/8/8/8/8/8/8/1NN1K3 w - - 0 1", false),       // two knights
+                    std::make_tuple("4k3/8/8/8/8/8/8/2BNK3 w - - 0 1", false),        // bishop and knight
+                    std::make_tuple("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1", false),        // pawn
+                    std::make_tuple("4k3/8/8/8/8/8/8/R3K3 w - - 0 1", false),         // rook
+                    std::make_tuple(kStandardStartingPosition, false)));
+
+TEST(FiftyMoveRule, GivenHundredPliesWithoutPawnMoveOrCapture_ExpectDraw)
+{
+    EXPECT_FALSE(IsDrawByRule(PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 99 80")));
+    EXPECT_TRUE(IsDrawByRule(PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 100 80")));
+    EXPECT_TRUE(IsDrawByRule(PositionFromFen("4k3/8/8/8/8/8/8/R3K3 b - - 120 80")));
+}
+
+TEST(FiftyMoveRule, GivenHundredPliesButInCheck_ExpectNoDrawYetAsCheckmatePrevails)
+{
+    EXPECT_FALSE(IsDrawByRule(PositionFromFen("R3k3/8/4K3/8/8/8/8/8 b - - 100 80")));
+}
+
+TEST(FiftyMoveRule, GivenHundredPliesRightAfterOpponentCastled_ExpectDrawAsNotInCheck)
+{
+    const Bitmove castling =
+        ComposeMove(tzcnt(E1), tzcnt(G1), kKing, kNoCapture, kNoPromotion, kMoveTypeKingsideCastling);
+    for (const std::string fen : {"4k3/8/8/8/8/8/3R4/4K2R w K - 99 80",  // square next to the king attacked
+                                  "1k6/8/8/8/8/8/8/4K2R w K - 99 80"})   // king next to the edge
+    {
+        Position position = PositionFromFen(fen);
+        position.MakeMove(castling);
+        EXPECT_TRUE(IsDrawByRule(position)) << fen;
+    }
+}
+
 }  // namespace
 }  // namespace Chess
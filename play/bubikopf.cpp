@@ -5,14 +5,76 @@
 #include "bitboard/uci_conversion.h"
 #include "evaluate/evaluate.h"
 #include "play/logging.h"
-#include "search/find_best_move.h"
+#include "search/iterative_deepening.h"
 
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <thread>
 
 namespace Chess
 {
 
+namespace
+{
+// Deepest search the principal variation can hold.
+constexpr std::size_t kMaximumFullSearchDepth{kMaximumLengthOfPrincipalVariation - 1};
+
+/// @brief Removes all root moves not contained in search_moves (if any of them is legal at all).
+void RestrictRootMoves(RootMoves& root_moves, const std::vector<std::string>& search_moves)
+{
+    if (search_moves.empty())
+    {
+        return;
+    }
+
+    RootMoves restricted_root_moves{};
+    std::copy_if(begin(root_moves),
+                 end(root_moves),
+                 std::back_inserter(restricted_root_moves),
+                 [&search_moves](const RootMove& root_move) {
+                     return std::find(begin(search_moves), end(search_moves), ToUciString(root_move.move)) !=
+                            end(search_moves);
+                 });
+
+    if (restricted_root_moves.empty())
+    {
+        ToCerrWithTime("None of the search moves is legal. Searching all moves instead.");
+        return;
+    }
+    root_moves = std::move(restricted_root_moves);
+}
+
+/// @brief Converts a negamax evaluation to a uci score, i.e. "cp <centipawns>" or "mate <moves>".
+std::string ToUciScore(const Evaluation negamax_evaluation)
+{
+    if (IsMateScore(negamax_evaluation))
+    {
+        const int plies_to_mate = kMate - std::abs(negamax_evaluation);
+        const int moves_to_mate = (plies_to_mate + 1) / 2;
+        return "mate " + std::to_string(negamax_evaluation > 0 ? moves_to_mate : -moves_to_mate);
+    }
+    return "cp " + std::to_string(negamax_evaluation);
+}
+
+std::string ToUciInfo(const std::size_t depth,
+                      const std::size_t multi_pv,
+                      const RootMove& line,
+                      const std::size_t number_of_nodes,
+                      const std::chrono::milliseconds time)
+{
+    std::string info = "depth " + std::to_string(depth) + " multipv " + std::to_string(multi_pv) + " score " +
+                       ToUciScore(line.evaluation) + " nodes " + std::to_string(number_of_nodes) + " time " +
+                       std::to_string(time.count()) + " pv";
+    for (const Bitmove move : line.principal_variation)
+    {
+        info.append(" ").append(ToUciString(move));
+    }
+    return info;
+}
+}  // namespace
+
 Bubikopf::Bubikopf()
 {
     SetUpBoardInStandardStartingPosition();
@@ -21,12 +83,14 @@ Bubikopf::Bubikopf()
 void Bubikopf::SetUpBoardAccordingToFen(const std::string& fen)
 {
     position_ = PositionFromFen(fen);
+    hash_history_ = HashHistory{position_};
     ToCerrWithTime("Set up fen: " + fen);
 }
 
 void Bubikopf::SetUpBoardInStandardStartingPosition()
 {
     position_ = PositionFromFen(kStandardStartingPosition);
+    hash_history_ = HashHistory{position_};
     ToCerrWithTime("Set up standard position.");
 }
 
@@ -44,10 +108,10 @@ void Bubikopf::UpdateBoard(const std::vector<std::string>& move_list)
     for (std::size_t new_move = played_plies_internal; new_move < move_list.size(); new_move++)
     {
         const std::string& new_move_uci = move_list[new_move];
-        const auto possible_moves_end = GenerateMoves<GenerateAllPseudoLegalMoves>(position_, begin(move_stack_));
+        const auto possible_moves_end = GenerateMoves<GenerateAllPseudoLegalMoves>(position_, move_stack_.begin());
 
         const auto move_to_play =
-            std::find_if(begin(move_stack_), possible_moves_end, [&new_move_uci](const auto& move) {
+            std::find_if(move_stack_.begin(), possible_moves_end, [&new_move_uci](const auto& move) {
                 return new_move_uci == ToUciString(move);
             });
 
@@ -59,34 +123,75 @@ void Bubikopf::UpdateBoard(const std::vector<std::string>& move_list)
         }
 
         ToCerrWithTime("Playing " + ToUciString(*move_to_play));
-        std::ignore = position_.MakeMove(*move_to_play);
+        const Bitboard extras_before_move = position_.MakeMove(*move_to_play);
+        hash_history_.Push(*move_to_play, extras_before_move, position_);
     }
 }
 
-std::tuple<std::string, Evaluation> Bubikopf::FindBestMove()
+std::tuple<std::string, Evaluation> Bubikopf::FindBestMove(const SearchLimits& search_limits,
+                                                          const std::atomic_bool* stop_requested,
+                                                          const std::function<void(const std::string&)>& send_info)
 {
+    const auto begin_of_search = std::chrono::steady_clock::now();
     ToCerrWithTime("Starting search for best move.");
-    const auto termination_time = std::chrono::steady_clock::now() + std::chrono::seconds{5};
-    const Position position_prior = position_;
-    std::size_t full_search_depth = 6;
-    Evaluation evaluation{};
-    try
-    {
-        while (true)
+    principal_variation_.Clear();  // Result must only depend on position and limits (reproducibility).
+
+    AbortCondition abort_condition{};
+    abort_condition.calculation_is_due = search_limits.move_time
+                                             ? std::chrono::steady_clock::now() + *search_limits.move_time
+                                             : std::chrono::steady_clock::time_point::max();
+    abort_condition.stop_requested = stop_requested;
+    abort_condition.node_limit = search_limits.nodes;
+    abort_condition.maximum_search_depth = std::clamp(search_limits.depth, std::size_t{1}, kMaximumFullSearchDepth);
+
+    RootMoves root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position_, move_stack_.begin());
+    RestrictRootMoves(root_moves, search_limits.search_moves);
+
+    SearchStatistic statistic{};
+    const ReportIteration report_iteration = [&](const IterationResult& iteration) {
+        if (!send_info)
+        {
+            return;
+        }
+        const auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                                begin_of_search);
+        for (std::size_t line{0}; line < iteration.lines.size(); line++)
         {
-            const AbortCondition abort_condition{full_search_depth, termination_time};
-            evaluation = Chess::FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial>(
-                position_, principal_variation_, begin(move_stack_), GetCurrentNegamaxSign(), abort_condition);
-            full_search_depth++;
-            ClearSublines(principal_variation_);
+            send_info(ToUciInfo(iteration.depth, line + 1, iteration.lines[line], statistic.number_of_nodes, time));
         }
+    };
+    const std::vector<IterationResult> iterations =
+        IterativeDeepening<GenerateAllPseudoLegalMoves, EvaluateMaterial>(position_,
+                                                                          principal_variation_,
+                                                                          hash_history_,
+                                                                          root_moves,
+                                                                          move_stack_.begin(),
+                                                                          GetCurrentNegamaxSign(),
+                                                                          abort_condition,
+                                                                          statistic,
+                                                                          search_limits.multi_pv,
+                                                                          report_iteration);
+    for (const IterationResult& iteration : iterations)
+    {
+        ToCerrWithTime("Depth " + std::to_string(iteration.depth) + ": " + ToUciString(iteration.best_move) + " (" +
+                       std::to_string(iteration.evaluation * GetCurrentNegamaxSign()) + ") after " +
+                       std::to_string(iteration.number_of_nodes) + " nodes in " +
+                       std::to_string(iteration.duration.count()) + "[us]");
     }
-    catch (const CalculationWasDue&)
+    ToCerrWithTime("Searched " + std::to_string(statistic.number_of_nodes) + " nodes.");
+
+    // In infinite mode the best move must not be reported before "stop", even if there is nothing left to search.
+    if (search_limits.infinite && stop_requested)
     {
-        position_ = position_prior;
+        while (!stop_requested->load())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
     }
-    const auto uci_move = ToUciString(principal_variation_.front());
+
+    const auto uci_move = ToUciString(principal_variation_.GetMove(0));
     ToCerrWithTime("Best move is: " + uci_move);
+    const Evaluation evaluation = iterations.empty() ? Evaluation{0} : iterations.back().evaluation;
     return {uci_move, evaluation * GetCurrentNegamaxSign()};
 }
 
@@ -97,7 +202,7 @@ void Bubikopf::PrintBoard() const
 
 Evaluation Bubikopf::GetCurrentNegamaxSign() const
 {
-    return position_.white_to_move_ ? Evaluation{1} : Evaluation{-1};
+    return position_.IsWhiteToMove() ? Evaluation{1} : Evaluation{-1};
 }
 
 }  // namespace Chess
@@ -3,8 +3,12 @@
 
 #include "bitboard/move_stack.h"
 #include "bitboard/position.h"
+#include "play/search_limits.h"
+#include "search/hash_history.h"
 #include "search/principal_variation.h"
 
+#include <atomic>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -18,13 +22,22 @@ class Bubikopf
     void SetUpBoardInStandardStartingPosition();
     void SetUpBoardAccordingToFen(const std::string& fen);
     void UpdateBoard(const std::vector<std::string>& move_list);
-    std::tuple<std::string, Evaluation> FindBestMove();
+
+    /// @brief Searches the current position within the given limits.
+    ///
+    /// Returns early (with the best move found so far) as soon as stop_requested is set from another thread.
+    /// After every completed iteration each of the best lines is handed to send_info as uci info, e.g.
+    /// "depth 5 multipv 1 score cp 100 nodes 4711 time 12 pv e2e4 e7e5".
+    std::tuple<std::string, Evaluation> FindBestMove(const SearchLimits& search_limits = {},
+                                                     const std::atomic_bool* stop_requested = nullptr,
+                                                     const std::function<void(const std::string&)>& send_info = {});
     void PrintBoard() const;
 
   private:
     Evaluation GetCurrentNegamaxSign() const;
 
     Position position_{};
+    HashHistory hash_history_{position_};  // of all positions played so far
     MoveStack move_stack_{};
     PrincipalVariation principal_variation_{};
 };
@@ -25,7 +25,9 @@ int main()
             {
                 uci_interactor.find_best_move_.store(false);
                 engine_api.UpdateBoard(uci_interactor.GetMoveList());
-                const auto [best_move, game_result] = engine_api.FindBestMove();
+                const auto send_info = [&uci_interactor](const std::string& info) { uci_interactor.SendInfo(info); };
+                const auto [best_move, game_result] =
+                    engine_api.FindBestMove(uci_interactor.GetSearchLimits(), &uci_interactor.stop_search_, send_info);
                 uci_interactor.SendBestMoveOnce(best_move);
             }
         }
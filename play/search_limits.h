@@ -0,0 +1,33 @@
+#ifndef PLAY_SEARCH_LIMITS_H
+#define PLAY_SEARCH_LIMITS_H
+
+#include <chrono>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+
+/// @brief Limits of a single search as requested by the gui via "go".
+struct SearchLimits
+{
+    /// Search until "stop" is received (e.g. "go infinite" for analysis).
+    bool infinite{false};
+
+    /// Without a move time the search is not limited by the clock. (Only node limited searches are reproducible.)
+    std::optional<std::chrono::milliseconds> move_time{std::chrono::seconds{5}};
+    std::size_t nodes{std::numeric_limits<std::size_t>::max()};
+    std::size_t depth{std::numeric_limits<std::size_t>::max()};
+
+    /// Number of best lines to search and report (as configured by the "MultiPV" option).
+    std::size_t multi_pv{1};
+
+    /// Restricts the search to these moves (in uci notation). All legal moves are searched if empty.
+    std::vector<std::string> search_moves{};
+};
+
+}  // namespace Chess
+
+#endif
@@ -1,9 +1,14 @@
 #include "bitboard/uci_conversion.h"
+#include "evaluate/evaluate.h"
 #include "play/bubikopf.h"
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <iostream>
+#include <thread>
 
 namespace Chess
 {
@@ -50,6 +55,125 @@ TEST_F(BubikopfTestFixture, DISABLED_GivenSelfPlay_ExpectGameFinishes)  // test
     std::cout << "Game result = " << game_result << '\n' << std::endl;
 }
 
+TEST_F(BubikopfTestFixture, GivenInfiniteSearch_WhenStopRequested_ExpectBestMoveReturnedPromptly)
+{
+    // Setup
+    engine_api.SetUpBoardAccordingToFen("8/8/8/4k3/8/8/8/4K2R w K - 0 1");
+    std::atomic_bool stop_requested{false};
+    SearchLimits search_limits{};
+    search_limits.infinite = true;
+
+    // Call
+    auto search = std::async(std::launch::async,
+                             [&]() { return engine_api.FindBestMove(search_limits, &stop_requested); });
+    std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    const auto stop_time = std::chrono::steady_clock::now();
+    stop_requested.store(true);
+    const auto [best_move, evaluation] = search.get();
+    const auto latency = std::chrono::steady_clock::now() - stop_time;
+
+    // Expect
+    EXPECT_NE(best_move, kUciNullMove);
+    EXPECT_LT(latency, std::chrono::milliseconds{100});
+    std::cout << "Latency from stop to best move = "
+              << std::chrono::duration_cast<std::chrono::microseconds>(latency).count() << "[us]" << std::endl;
+}
+
+TEST_F(BubikopfTestFixture, GivenNodeLimit_ExpectIdenticalResultsOnEveryRun)
+{
+    // Setup
+    constexpr const char* const middle_game =
+        "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10";
+    SearchLimits search_limits{};
+    search_limits.nodes = 200000;
+    search_limits.move_time.reset();
+
+    // Call
+    engine_api.SetUpBoardAccordingToFen(middle_game);
+    const auto first_run = engine_api.FindBestMove(search_limits);
+    engine_api.SetUpBoardInStandardStartingPosition();
+    std::ignore = engine_api.FindBestMove(search_limits);  // leave different state behind
+    engine_api.SetUpBoardAccordingToFen(middle_game);
+    const auto second_run = engine_api.FindBestMove(search_limits);
+
+    // Expect
+    EXPECT_EQ(first_run, second_run);
+}
+
+TEST_F(BubikopfTestFixture, GivenNodeLimitOfOne_ExpectBestMoveNonetheless)
+{
+    // Setup
+    engine_api.UpdateBoard({"e2e4"});
+    SearchLimits search_limits{};
+    search_limits.nodes = 1;
+    search_limits.move_time.reset();
+
+    // Call
+    const auto [best_move, evaluation] = engine_api.FindBestMove(search_limits);
+
+    // Expect
+    EXPECT_NE(best_move, kUciNullMove);
+}
+
+TEST_F(BubikopfTestFixture, GivenDepthLimitOnly_ExpectSearchFinishesWithoutDeadline)
+{
+    // Setup
+    SearchLimits search_limits{};
+    search_limits.depth = 2;
+    search_limits.move_time.reset();
+
+    // Call
+    const auto begin = std::chrono::steady_clock::now();
+    const auto [best_move, evaluation] = engine_api.FindBestMove(search_limits);
+    const auto duration = std::chrono::steady_clock::now() - begin;
+
+    // Expect
+    EXPECT_NE(best_move, kUciNullMove);
+    EXPECT_LT(duration, std::chrono::seconds{1});
+}
+
+TEST_F(BubikopfTestFixture, GivenSearchMoves_ExpectBestMoveAmongThem)
+{
+    // Setup
+    engine_api.SetUpBoardAccordingToFen("r4k2/p3R3/2p1R1pp/1p3pN1/6n1/8/PPPr2PP/7K w - - 14 32");
+    SearchLimits search_limits{};
+    search_limits.depth = 6;
+    search_limits.move_time.reset();
+    search_limits.search_moves = {"h2h3", "a2a3"};  // excludes the mate e7f7
+
+    // Call
+    const auto [best_move, evaluation] = engine_api.FindBestMove(search_limits);
+
+    // Expect
+    EXPECT_TRUE(best_move == "h2h3" || best_move == "a2a3") << best_move;
+    EXPECT_LT(evaluation, MateIn(5));
+}
+
+TEST_F(BubikopfTestFixture, GivenMultiPv_ExpectInfoForEveryLineOfEveryDepth)
+{
+    // Setup
+    engine_api.SetUpBoardAccordingToFen("r4k2/p3R3/2p1R1pp/1p3pN1/6n1/8/PPPr2PP/7K w - - 14 32");
+    SearchLimits search_limits{};
+    search_limits.depth = 6;
+    search_limits.move_time.reset();
+    search_limits.multi_pv = 3;
+    std::vector<std::string> infos{};
+
+    // Call
+    const auto [best_move, evaluation] =
+        engine_api.FindBestMove(search_limits, nullptr, [&infos](const std::string& info) { infos.push_back(info); });
+
+    // Expect
+    ASSERT_EQ(infos.size(), 6 * 3);
+    EXPECT_EQ(infos.front().rfind("depth 1 multipv 1 score ", 0), 0) << infos.front();
+    EXPECT_EQ(infos.at(1).rfind("depth 1 multipv 2 score ", 0), 0) << infos.at(1);
+    EXPECT_EQ(infos.back().rfind("depth 6 multipv 3 score ", 0), 0) << infos.back();
+    const std::string& best_line_at_depth_6 = infos.at(5 * 3);
+    EXPECT_EQ(best_line_at_depth_6.rfind("depth 6 multipv 1 score mate 3 ", 0), 0) << best_line_at_depth_6;
+    EXPECT_NE(best_line_at_depth_6.find(" pv e7f7 "), std::string::npos) << best_line_at_depth_6;
+    EXPECT_EQ(best_move, "e7f7");
+}
+
 class BubikopfFindBestMoveTestFixture
     : public BubikopfTestFixture,
       public testing::WithParamInterface<std::tuple<std::string, std::string, Evaluation>>
@@ -74,8 +198,8 @@ TEST_P(BubikopfFindBestMoveTestFixture, GivenCheckmateIn4_ExpectCorrectContinuat
 }
 
 const std::array<std::tuple<std::string, std::string, Evaluation>, 2> kCheckMateInThreePositions{{
-    {"r4k2/pp2qp2/8/3N3r/3P4/1Q4p1/PP4P1/R4RK1 b - - 0 22", "h5h1", Evaluation{-995}},
-    {"r4k2/p3R3/2p1R1pp/1p3pN1/6n1/8/PPPr2PP/7K w - - 14 32", "e7f7", Evaluation{995}},
+    {"r4k2/pp2qp2/8/3N3r/3P4/1Q4p1/PP4P1/R4RK1 b - - 0 22", "h5h1", MatedIn(5)},
+    {"r4k2/p3R3/2p1R1pp/1p3pN1/6n1/8/PPPr2PP/7K w - - 14 32", "e7f7", MateIn(5)},
 }};
 
 INSTANTIATE_TEST_SUITE_P(CheckMateInThreePositions,
@@ -0,0 +1,99 @@
+#include "play/uci_interactor.h"
+
+#include <gtest/gtest.h>
+
+namespace Chess
+{
+namespace
+{
+
+TEST(ParseGoCommandTest, GivenPlainGo_ExpectDefaultMoveTime)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go"});
+    EXPECT_FALSE(search_limits.infinite);
+    EXPECT_EQ(search_limits.move_time, SearchLimits{}.move_time);
+    EXPECT_EQ(search_limits.nodes, SearchLimits{}.nodes);
+    EXPECT_EQ(search_limits.depth, SearchLimits{}.depth);
+}
+
+TEST(ParseGoCommandTest, GivenGoInfinite_ExpectNoMoveTime)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "infinite"});
+    EXPECT_TRUE(search_limits.infinite);
+    EXPECT_FALSE(search_limits.move_time.has_value());
+}
+
+TEST(ParseGoCommandTest, GivenGoNodes_ExpectNodeLimitWithoutMoveTime)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "nodes", "100000"});
+    EXPECT_EQ(search_limits.nodes, 100000);
+    EXPECT_FALSE(search_limits.move_time.has_value());
+}
+
+TEST(ParseGoCommandTest, GivenGoDepthAndMoveTime_ExpectBothLimits)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "depth", "7", "movetime", "1500"});
+    EXPECT_EQ(search_limits.depth, 7);
+    EXPECT_EQ(search_limits.move_time, std::chrono::milliseconds{1500});
+}
+
+TEST(ParseGoCommandTest, GivenUnsupportedParameters_ExpectIgnored)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "wtime", "1000", "btime", "1000", "depth", "3"});
+    EXPECT_EQ(search_limits.depth, 3);
+    EXPECT_EQ(search_limits.nodes, SearchLimits{}.nodes);
+}
+
+TEST(ParseGoCommandTest, GivenGoSearchMoves_ExpectMovesUntilNextParameter)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "searchmoves", "e2e4", "d2d4", "depth", "3"});
+    EXPECT_EQ(search_limits.search_moves, (std::vector<std::string>{"e2e4", "d2d4"}));
+    EXPECT_EQ(search_limits.depth, 3);
+}
+
+TEST(ParseGoCommandTest, GivenInvalidValues_ExpectIgnored)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "movetime", "abc", "nodes", "12x", "depth", "3"});
+    EXPECT_EQ(search_limits.move_time, std::nullopt);  // limited by depth only
+    EXPECT_EQ(search_limits.nodes, SearchLimits{}.nodes);
+    EXPECT_EQ(search_limits.depth, 3);
+}
+
+TEST(ParseGoCommandTest, GivenNegativeMoveTime_ExpectDefaultMoveTime)
+{
+    const SearchLimits search_limits = ParseGoCommand({"go", "movetime", "-100"});
+    EXPECT_EQ(search_limits.move_time, SearchLimits{}.move_time);
+}
+
+TEST(ParseGoCommandTest, GivenValuesOutOfRange_ExpectIgnored)
+{
+    const SearchLimits search_limits =
+        ParseGoCommand({"go", "nodes", "99999999999999999999999", "movetime", "99999999999999999999999"});
+    EXPECT_EQ(search_limits.nodes, SearchLimits{}.nodes);
+    EXPECT_EQ(search_limits.move_time, SearchLimits{}.move_time);
+}
+
+TEST(ParseMultiPvOptionTest, GivenMultiPvOption_ExpectNumberOfLines)
+{
+    EXPECT_EQ(ParseMultiPvOption({"setoption", "name", "MultiPV", "value", "3"}), std::size_t{3});
+}
+
+TEST(ParseMultiPvOptionTest, GivenOutOfRangeValue_ExpectClamped)
+{
+    EXPECT_EQ(ParseMultiPvOption({"setoption", "name", "MultiPV", "value", "0"}), std::size_t{1});
+    EXPECT_EQ(ParseMultiPvOption({"setoption", "name", "MultiPV", "value", "1000"}), kMaximumMultiPv);
+}
+
+TEST(ParseMultiPvOptionTest, GivenInvalidValue_ExpectNothing)
+{
+    EXPECT_FALSE(ParseMultiPvOption({"setoption", "name", "MultiPV", "value", "x"}).has_value());
+    EXPECT_FALSE(ParseMultiPvOption({"setoption", "name", "MultiPV", "value", "-3"}).has_value());
+}
+
+TEST(ParseMultiPvOptionTest, GivenOtherOption_ExpectNothing)
+{
+    EXPECT_FALSE(ParseMultiPvOption({"setoption", "name", "Hash", "value", "16"}).has_value());
+}
+
+}  // namespace
+}  // namespace Chess
@@ -2,13 +2,123 @@
 
 #include "play/logging.h"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <iostream>
 #include <iterator>
 #include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 
 namespace Chess
 {
 
+namespace
+{
+bool IsGoParameter(const std::string& token)
+{
+    constexpr std::array<std::string_view, 12> go_parameters{
+        "searchmoves", "ponder", "wtime", "btime", "winc", "binc", "movestogo", "depth", "nodes", "mate", "movetime",
+        "infinite"};
+    return std::find(begin(go_parameters), end(go_parameters), token) != end(go_parameters);
+}
+
+/// @returns The value of the token, nothing if it is no non-negative number (which is ignored like unknown tokens).
+template <typename Number>
+std::optional<Number> ParseNonNegativeNumber(const std::string& token)
+{
+    Number value{};
+    const char* const end_of_token = token.data() + token.size();
+    const auto [end_of_number, error] = std::from_chars(token.data(), end_of_token, value);
+    bool is_valid = (error == std::errc{}) && (end_of_number == end_of_token);
+    if constexpr (std::is_signed_v<Number>)
+    {
+        is_valid = is_valid && (value >= Number{0});
+    }
+    if (!is_valid)
+    {
+        ToCerrWithTime("Ignoring invalid value: " + token);
+        return std::nullopt;
+    }
+    return value;
+}
+}  // namespace
+
+SearchLimits ParseGoCommand(const std::vector<std::string>& tokens)
+{
+    SearchLimits search_limits{};
+    bool move_time_given{false};
+    bool other_limit_given{false};
+
+    for (auto token = begin(tokens); token != end(tokens); token++)
+    {
+        const bool value_follows = std::next(token) != end(tokens);
+        if (*token == "infinite")
+        {
+            search_limits.infinite = true;
+        }
+        else if (*token == "movetime" && value_follows)
+        {
+            const auto move_time = ParseNonNegativeNumber<std::chrono::milliseconds::rep>(*++token);
+            if (move_time)
+            {
+                search_limits.move_time = std::chrono::milliseconds{*move_time};
+                move_time_given = true;
+            }
+        }
+        else if (*token == "nodes" && value_follows)
+        {
+            const auto nodes = ParseNonNegativeNumber<std::size_t>(*++token);
+            if (nodes)
+            {
+                search_limits.nodes = *nodes;
+                other_limit_given = true;
+            }
+        }
+        else if (*token == "depth" && value_follows)
+        {
+            const auto depth = ParseNonNegativeNumber<std::size_t>(*++token);
+            if (depth)
+            {
+                search_limits.depth = *depth;
+                other_limit_given = true;
+            }
+        }
+        else if (*token == "searchmoves")
+        {
+            while ((std::next(token) != end(tokens)) && !IsGoParameter(*std::next(token)))
+            {
+                search_limits.search_moves.push_back(*++token);
+            }
+        }
+    }
+
+    if ((search_limits.infinite || other_limit_given) && !move_time_given)
+    {
+        search_limits.move_time.reset();
+    }
+
+    return search_limits;
+}
+
+std::optional<std::size_t> ParseMultiPvOption(const std::vector<std::string>& tokens)
+{
+    const bool is_multi_pv_option = (tokens.size() == 5) && (tokens.at(1) == "name") && (tokens.at(2) == "MultiPV") &&
+                                    (tokens.at(3) == "value");
+    if (!is_multi_pv_option)
+    {
+        return std::nullopt;
+    }
+    const auto multi_pv = ParseNonNegativeNumber<std::size_t>(tokens.at(4));
+    if (!multi_pv)
+    {
+        return std::nullopt;
+    }
+    return std::clamp(*multi_pv, std::size_t{1}, kMaximumMultiPv);
+}
+
 void UciInteractor::ParseIncomingCommandsContinously()
 {
     // Read new lines from std::cin in infinite loop
@@ -20,16 +130,28 @@ void UciInteractor::ParseIncomingCommandsContinously()
         std::istringstream iss{line};
         const std::vector<std::string> tokens{std::istream_iterator<std::string>{iss},
                                               std::istream_iterator<std::string>{}};
+        if (tokens.empty())
+        {
+            continue;
+        }
 
         if (tokens.front() == "uci")
         {
+            ToCout("option name MultiPV type spin default 1 min 1 max " + std::to_string(kMaximumMultiPv));
             ToCout("uciok");
             continue;
         }
 
         if (tokens.front() == "setoption")
         {
-            // Do nothing. Configuration is done via config of lichess bot.
+            const auto multi_pv = ParseMultiPvOption(tokens);
+            if (multi_pv)
+            {
+                multi_pv_ = *multi_pv;
+                ToCerrWithTime("Set: MultiPV " + std::to_string(multi_pv_));
+                continue;
+            }
+            // Do nothing else. Configuration is done via config of lichess bot.
             ToCerrWithTime("noop");
             continue;
         }
@@ -58,13 +180,26 @@ void UciInteractor::ParseIncomingCommandsContinously()
 
         if (tokens.front() == "go")
         {
+            SearchLimits search_limits = ParseGoCommand(tokens);
+            search_limits.multi_pv = multi_pv_;
+            SetSearchLimits(search_limits);
+            stop_search_.store(false);  // Reset here, as "stop" may arrive before the search has actually started.
             find_best_move_.store(true);
-            ToCerrWithTime("Set: Go");
+            ToCerrWithTime("Set: " + line);
+            continue;
+        }
+
+        if (tokens.front() == "stop")
+        {
+            stop_received_.store(std::chrono::steady_clock::now());
+            stop_search_.store(true);
+            ToCerrWithTime("Set: Stop");
             continue;
         }
 
         if (tokens.front() == "quit")
         {
+            stop_search_.store(true);
             quit_game_.store(true);
             ToCerrWithTime("Set: Quit");
             break;
@@ -79,6 +214,19 @@ void UciInteractor::ParseIncomingCommandsContinously()
 void UciInteractor::SendBestMoveOnce(const std::string& move)
 {
     ToCout("bestmove " + move);
+
+    const auto stop_received = stop_received_.exchange(std::chrono::steady_clock::time_point::min());
+    if (stop_received != std::chrono::steady_clock::time_point::min())
+    {
+        const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                   stop_received);
+        ToCerrWithTime("Latency from stop to bestmove: " + std::to_string(latency.count()) + "[us]");
+    }
+}
+
+void UciInteractor::SendInfo(const std::string& info)
+{
+    ToCout("info " + info);
 }
 
 std::vector<std::string> UciInteractor::GetMoveList()
@@ -87,6 +235,18 @@ std::vector<std::string> UciInteractor::GetMoveList()
     return move_list_;
 }
 
+SearchLimits UciInteractor::GetSearchLimits()
+{
+    const std::lock_guard<std::mutex> search_limits_guard{search_limits_mutex_};
+    return search_limits_;
+}
+
+void UciInteractor::SetSearchLimits(const SearchLimits& search_limits)
+{
+    const std::lock_guard<std::mutex> search_limits_guard{search_limits_mutex_};
+    search_limits_ = search_limits;
+}
+
 void UciInteractor::SetMoveList(std::vector<std::string>&& move_list)
 {
     const std::lock_guard<std::mutex> move_list_guard{move_list_mutex_};
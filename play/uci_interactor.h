@@ -1,33 +1,66 @@
 #ifndef PLAY_UCI_INTERACTOR_H
 #define PLAY_UCI_INTERACTOR_H
 
+#include "play/search_limits.h"
+
 #include <atomic>
+#include <chrono>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace Chess
 {
 
+/// @brief Parses the tokens of a "go" command, e.g. "go depth 6" or "go nodes 100000 movetime 2000".
+///
+/// Unsupported parameters and invalid values (e.g. "movetime abc" or negative numbers) are ignored. A search limited by
+/// depth or nodes only is not limited by time.
+SearchLimits ParseGoCommand(const std::vector<std::string>& tokens);
+
+constexpr std::size_t kMaximumMultiPv{256};
+
+/// @brief Parses the tokens of "setoption name MultiPV value <k>".
+///
+/// @returns The number of lines (clamped to [1, kMaximumMultiPv]), nothing if tokens set a different option or the value
+/// is no number.
+std::optional<std::size_t> ParseMultiPvOption(const std::vector<std::string>& tokens);
+
 class UciInteractor
 {
   public:
     void ParseIncomingCommandsContinously();
     void SendBestMoveOnce(const std::string& move);
+    void SendInfo(const std::string& info);
     std::vector<std::string> GetMoveList();
+    SearchLimits GetSearchLimits();
 
     std::atomic_bool quit_game_{false};
     std::atomic_bool restart_game_{false};
     std::atomic_bool find_best_move_{false};
 
+    /// @brief Is polled by a running search, which ends as soon as it is set.
+    std::atomic_bool stop_search_{false};
+
   private:
     void SetMoveList(std::vector<std::string>&& move_list);
+    void SetSearchLimits(const SearchLimits& search_limits);
 
     /// @brief Writes thread-safe to cout.
     void ToCout(const std::string& command);
 
     std::vector<std::string> move_list_{};
     std::mutex move_list_mutex_{};
+
+    SearchLimits search_limits_{};
+    std::mutex search_limits_mutex_{};
+
+    /// Number of lines to report, is applied to every following "go". (Only accessed by the uci thread.)
+    std::size_t multi_pv_{1};
+
+    /// Used to measure the latency between "stop" and "bestmove".
+    std::atomic<std::chrono::steady_clock::time_point> stop_received_{std::chrono::steady_clock::time_point::min()};
 };
 
 }  // namespace Chess
@@ -1,7 +1,9 @@
 #ifndef SEACH_ABORT_CONDITION_H
 #define SEACH_ABORT_CONDITION_H
 
+#include <atomic>
 #include <chrono>
+#include <limits>
 
 namespace Chess
 {
@@ -13,12 +15,46 @@ struct CalculationWasDue
 {
 };
 
+/// @brief Stop flag and clock are only polled every this many nodes. (The node limit is checked on every node.)
+constexpr std::size_t kNodesBetweenPolls{1024};
+
 struct AbortCondition
 {
     std::size_t full_search_depth{0};
     std::chrono::steady_clock::time_point calculation_is_due{std::chrono::steady_clock::time_point::max()};
+
+    /// Set from outside the search (e.g. by "stop" or "quit") to end it as soon as possible.
+    const std::atomic_bool* stop_requested{nullptr};
+
+    /// Searches limited by nodes (and not by time) are reproducible, i.e. yield bit-identical results on every run.
+    std::size_t node_limit{std::numeric_limits<std::size_t>::max()};
+
+    /// Deepest full search depth an iterative deepening driver may start.
+    std::size_t maximum_search_depth{std::numeric_limits<std::size_t>::max()};
 };
 
+/// @brief Throws CalculationWasDue if the search exceeded one of its limits or was requested to stop.
+inline void ThrowIfCalculationIsDue(const AbortCondition& abort_condition, const std::size_t number_of_nodes)
+{
+    if (number_of_nodes > abort_condition.node_limit)
+    {
+        throw CalculationWasDue{};
+    }
+
+    const bool is_time_to_poll = (number_of_nodes % kNodesBetweenPolls) == 0;
+    if (is_time_to_poll)
+    {
+        if (abort_condition.stop_requested && abort_condition.stop_requested->load(std::memory_order_relaxed))
+        {
+            throw CalculationWasDue{};
+        }
+        if (std::chrono::steady_clock::now() > abort_condition.calculation_is_due)
+        {
+            throw CalculationWasDue{};
+        }
+    }
+}
+
 }  // namespace Chess
 
 #endif
@@ -2,6 +2,7 @@
 #include "bitboard/generate_moves.h"
 #include "evaluate/evaluate.h"
 #include "search/find_best_move.h"
+#include "search/find_best_move_non_recursive.h"
 
 #include <benchmark/benchmark.h>
 
@@ -15,28 +16,172 @@ constexpr Chess::Evaluation kNegamaxEvaluationSignWhite{1};
 
 }  // namespace
 
+/// Forward pruning and the way moves are made are given as template arguments for A/B comparisons.
+template <typename PruneBehavior, typename MakeBehavior = Chess::MakeAndUnmakeMoves>
 static void FindBestMove(benchmark::State& state)
 {
     Chess::MoveStack move_stack{};
     Chess::PrincipalVariation principal_variation{};
+    Chess::SearchStatistic statistic{};
     Chess::Position start_position = Chess::PositionFromFen(kStartPositionFen);
     Chess::Position middle_game = Chess::PositionFromFen(kMiddleGameFen);
     Chess::Position end_game = Chess::PositionFromFen(kEndGameFen);
+    Chess::HashHistory start_position_history{start_position};
+    Chess::HashHistory middle_game_history{middle_game};
+    Chess::HashHistory end_game_history{end_game};
     constexpr std::size_t full_search_depth = 6;
     constexpr Chess::AbortCondition abort_condition{full_search_depth};
 
     for (auto _ : state)
     {
-        Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
-            start_position, principal_variation, move_stack.begin(), kNegamaxEvaluationSignWhite, abort_condition);
-        principal_variation.fill(Chess::kBitNullMove);
-        Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
-            middle_game, principal_variation, move_stack.begin(), kNegamaxEvaluationSignWhite, abort_condition);
-        principal_variation.fill(Chess::kBitNullMove);
-        Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
-            end_game, principal_variation, move_stack.begin(), kNegamaxEvaluationSignWhite, abort_condition);
+        Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves,
+                            Chess::EvaluateMaterial,
+                            Chess::DebuggingDisabled,
+                            PruneBehavior,
+                            MakeBehavior>(start_position,
+                                          principal_variation,
+                                          start_position_history,
+                                          move_stack.begin(),
+                                          kNegamaxEvaluationSignWhite,
+                                          abort_condition,
+                                          statistic);
+        principal_variation.Clear();
+        Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves,
+                            Chess::EvaluateMaterial,
+                            Chess::DebuggingDisabled,
+                            PruneBehavior,
+                            MakeBehavior>(middle_game,
+                                          principal_variation,
+                                          middle_game_history,
+                                          move_stack.begin(),
+                                          kNegamaxEvaluationSignWhite,
+                                          abort_condition,
+                                          statistic);
+        principal_variation.Clear();
+        Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves,
+                            Chess::EvaluateMaterial,
+                            Chess::DebuggingDisabled,
+                            PruneBehavior,
+                            MakeBehavior>(end_game,
+                                          principal_variation,
+                                          end_game_history,
+                                          move_stack.begin(),
+                                          kNegamaxEvaluationSignWhite,
+                                          abort_condition,
+                                          statistic);
     }
+    state.counters["nodes"] = benchmark::Counter(statistic.number_of_nodes, benchmark::Counter::kAvgIterations);
+    state.counters["nodes_per_second"] = benchmark::Counter(statistic.number_of_nodes, benchmark::Counter::kIsRate);
 }
-BENCHMARK(FindBestMove)->Unit(benchmark::kMillisecond)->ReportAggregatesOnly()->Repetitions(10);
+BENCHMARK_TEMPLATE(FindBestMove, Chess::ForwardPruningEnabled)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(FindBestMove, Chess::ForwardPruningWithMultiCut)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(FindBestMove, Chess::ForwardPruningDisabled)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(FindBestMove, Chess::ForwardPruningEnabled, Chess::CopyAndMakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+
+/// Same searches as FindBestMove without forward pruning, but without recursion.
+static void FindBestMoveNonRecursive(benchmark::State& state)
+{
+    Chess::MoveStack move_stack{};
+    Chess::SearchStack search_stack{};
+    Chess::PrincipalVariation principal_variation{};
+    Chess::SearchStatistic statistic{};
+    Chess::Position start_position = Chess::PositionFromFen(kStartPositionFen);
+    Chess::Position middle_game = Chess::PositionFromFen(kMiddleGameFen);
+    Chess::Position end_game = Chess::PositionFromFen(kEndGameFen);
+    Chess::HashHistory start_position_history{start_position};
+    Chess::HashHistory middle_game_history{middle_game};
+    Chess::HashHistory end_game_history{end_game};
+    constexpr std::size_t full_search_depth = 6;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+
+    for (auto _ : state)
+    {
+        Chess::FindBestMoveNonRecursive<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
+            start_position,
+            principal_variation,
+            start_position_history,
+            search_stack,
+            move_stack.begin(),
+            kNegamaxEvaluationSignWhite,
+            abort_condition,
+            statistic);
+        principal_variation.Clear();
+        Chess::FindBestMoveNonRecursive<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
+            middle_game,
+            principal_variation,
+            middle_game_history,
+            search_stack,
+            move_stack.begin(),
+            kNegamaxEvaluationSignWhite,
+            abort_condition,
+            statistic);
+        principal_variation.Clear();
+        Chess::FindBestMoveNonRecursive<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
+            end_game,
+            principal_variation,
+            end_game_history,
+            search_stack,
+            move_stack.begin(),
+            kNegamaxEvaluationSignWhite,
+            abort_condition,
+            statistic);
+    }
+    state.counters["nodes"] = benchmark::Counter(statistic.number_of_nodes, benchmark::Counter::kAvgIterations);
+    state.counters["nodes_per_second"] = benchmark::Counter(statistic.number_of_nodes, benchmark::Counter::kIsRate);
+}
+BENCHMARK(FindBestMoveNonRecursive)->Unit(benchmark::kMillisecond)->ReportAggregatesOnly()->Repetitions(10);
+
+/// Visits exactly the same nodes on every run and machine, regardless of how deep they get within the node limit.
+static void FindBestMoveNodeLimited(benchmark::State& state)
+{
+    Chess::MoveStack move_stack{};
+    Chess::PrincipalVariation principal_variation{};
+    Chess::SearchStatistic statistic{};
+    Chess::Position middle_game = Chess::PositionFromFen(kMiddleGameFen);
+    Chess::HashHistory middle_game_history{middle_game};
+    Chess::AbortCondition abort_condition{};
+    abort_condition.node_limit = 1000000;
+
+    for (auto _ : state)
+    {
+        principal_variation.Clear();
+        statistic = {};
+        try
+        {
+            for (abort_condition.full_search_depth = 1;; abort_condition.full_search_depth++)
+            {
+                Chess::FindBestMove<Chess::GenerateAllPseudoLegalMoves, Chess::EvaluateMaterial>(
+                    middle_game,
+                    principal_variation,
+                    middle_game_history,
+                    move_stack.begin(),
+                    kNegamaxEvaluationSignWhite,
+                    abort_condition,
+                    statistic);
+                principal_variation.ClearSublines();
+            }
+        }
+        catch (const Chess::CalculationWasDue&)
+        {
+            middle_game = Chess::PositionFromFen(kMiddleGameFen);
+            middle_game_history = Chess::HashHistory{middle_game};
+        }
+    }
+    state.counters["nodes_per_second"] = benchmark::Counter(static_cast<double>(abort_condition.node_limit),
+                                                            benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(FindBestMoveNodeLimited)->Unit(benchmark::kMillisecond)->ReportAggregatesOnly()->Repetitions(10);
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -24,7 +24,8 @@ int main(int argc, char** argv)
     const Chess::AbortCondition abort_condition{depth};
 
     std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
-    Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves>(position, move_stack.begin(), stats, abort_condition);
+    Chess::CountAllLeavesInBulk<Chess::GenerateAllPseudoLegalMovesWithKoggeStoneSliders>(
+        position, move_stack.begin(), stats, abort_condition);
     std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
 
     std::cout << "Number of static evaluations " << stats.number_of_evaluations << std::endl;
@@ -1,3 +1,4 @@
+#include "bitboard/attack_maps.h"
 #include "bitboard/fen_conversion.h"
 #include "bitboard/generate_moves.h"
 #include "search/traverse_all_leaves.h"
@@ -14,6 +15,8 @@ constexpr Chess::Evaluation kNegamaxEvaluationSignWhite{1};
 
 }  // namespace
 
+/// The way moves are made is given as template argument for A/B comparisons.
+template <typename MakeBehavior>
 static void TraverseAllLeavesStartPosition(benchmark::State& state)
 {
     Chess::MoveStack move_stack{};
@@ -24,12 +27,20 @@ static void TraverseAllLeavesStartPosition(benchmark::State& state)
 
     for (auto _ : state)
     {
-        Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves>(
+        Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves, MakeBehavior>(
             start_position, move_stack.begin(), stats, abort_condition);
     }
 }
-BENCHMARK(TraverseAllLeavesStartPosition)->Unit(benchmark::kMillisecond)->ReportAggregatesOnly()->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesStartPosition, Chess::MakeAndUnmakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesStartPosition, Chess::CopyAndMakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
 
+template <typename MakeBehavior>
 static void TraverseAllLeavesMiddleGame(benchmark::State& state)
 {
     Chess::MoveStack move_stack{};
@@ -40,12 +51,20 @@ static void TraverseAllLeavesMiddleGame(benchmark::State& state)
 
     for (auto _ : state)
     {
-        Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves>(
+        Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves, MakeBehavior>(
             middle_game, move_stack.begin(), stats, abort_condition);
     }
 }
-BENCHMARK(TraverseAllLeavesMiddleGame)->Unit(benchmark::kMillisecond)->ReportAggregatesOnly()->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesMiddleGame, Chess::MakeAndUnmakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesMiddleGame, Chess::CopyAndMakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
 
+template <typename MakeBehavior>
 static void TraverseAllLeavesEndGame(benchmark::State& state)
 {
     Chess::MoveStack move_stack{};
@@ -56,10 +75,90 @@ static void TraverseAllLeavesEndGame(benchmark::State& state)
 
     for (auto _ : state)
     {
-        Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves>(
+        Chess::TraverseAllLeaves<Chess::GenerateAllPseudoLegalMoves, MakeBehavior>(
             end_game, move_stack.begin(), stats, abort_condition);
     }
 }
-BENCHMARK(TraverseAllLeavesEndGame)->Unit(benchmark::kMillisecond)->ReportAggregatesOnly()->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesEndGame, Chess::MakeAndUnmakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesEndGame, Chess::CopyAndMakeMoves)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+
+/// Attack maps per node, computed from scratch or derived from the parent, for finding out when updating pays off.
+template <typename AttackMapsBehavior>
+static void TraverseAllLeavesWithAttackMapsStartPosition(benchmark::State& state)
+{
+    Chess::MoveStack move_stack{};
+    Chess::Statistic stats{};
+    Chess::Position start_position = Chess::PositionFromFen(kStartPositionFen);
+    constexpr std::size_t full_search_depth = 4;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+
+    for (auto _ : state)
+    {
+        Chess::TraverseAllLeavesWithAttackMaps<Chess::GenerateAllPseudoLegalMoves, AttackMapsBehavior>(
+            start_position, Chess::ComputeAttackMaps(start_position), move_stack.begin(), stats, abort_condition);
+    }
+}
+BENCHMARK_TEMPLATE(TraverseAllLeavesWithAttackMapsStartPosition, Chess::RecomputeAttackMaps)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesWithAttackMapsStartPosition, Chess::UpdateAttackMapsIncrementally)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+
+template <typename AttackMapsBehavior>
+static void TraverseAllLeavesWithAttackMapsMiddleGame(benchmark::State& state)
+{
+    Chess::MoveStack move_stack{};
+    Chess::Statistic stats{};
+    Chess::Position middle_game = Chess::PositionFromFen(kMiddleGameFen);
+    constexpr std::size_t full_search_depth = 4;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+
+    for (auto _ : state)
+    {
+        Chess::TraverseAllLeavesWithAttackMaps<Chess::GenerateAllPseudoLegalMoves, AttackMapsBehavior>(
+            middle_game, Chess::ComputeAttackMaps(middle_game), move_stack.begin(), stats, abort_condition);
+    }
+}
+BENCHMARK_TEMPLATE(TraverseAllLeavesWithAttackMapsMiddleGame, Chess::RecomputeAttackMaps)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesWithAttackMapsMiddleGame, Chess::UpdateAttackMapsIncrementally)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+
+template <typename AttackMapsBehavior>
+static void TraverseAllLeavesWithAttackMapsEndGame(benchmark::State& state)
+{
+    Chess::MoveStack move_stack{};
+    Chess::Statistic stats{};
+    Chess::Position end_game = Chess::PositionFromFen(kEndGameFen);
+    constexpr std::size_t full_search_depth = 5;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+
+    for (auto _ : state)
+    {
+        Chess::TraverseAllLeavesWithAttackMaps<Chess::GenerateAllPseudoLegalMoves, AttackMapsBehavior>(
+            end_game, Chess::ComputeAttackMaps(end_game), move_stack.begin(), stats, abort_condition);
+    }
+}
+BENCHMARK_TEMPLATE(TraverseAllLeavesWithAttackMapsEndGame, Chess::RecomputeAttackMaps)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
+BENCHMARK_TEMPLATE(TraverseAllLeavesWithAttackMapsEndGame, Chess::UpdateAttackMapsIncrementally)
+    ->Unit(benchmark::kMillisecond)
+    ->ReportAggregatesOnly()
+    ->Repetitions(10);
 
 BENCHMARK_MAIN();
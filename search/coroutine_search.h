@@ -0,0 +1,128 @@
+#ifndef SEARCH_COROUTINE_SEARCH_H
+#define SEARCH_COROUTINE_SEARCH_H
+
+#include "bitboard/move_stack.h"
+#include "bitboard/position.h"
+#include "search/abort_condition.h"
+#include "search/find_best_move.h"
+#include "search/hash_history.h"
+#include "search/find_best_move_non_recursive.h"
+#include "search/principal_variation.h"
+#include "search/search_stack.h"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace Chess
+{
+
+struct SearchResult
+{
+    Evaluation evaluation{};  // in negamax notation, i.e. from the perspective of the side to move
+    std::vector<Bitmove> principal_variation{};
+    SearchStatistic statistic{};
+};
+
+/// @brief Handle of a search running as coroutine (see FindBestMoveCoroutine).
+///
+/// The search does not start before the first call to Resume. Every call runs it for one time slice.
+class SearchTask
+{
+  public:
+    struct promise_type
+    {
+        SearchTask get_return_object() { return SearchTask{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_value(SearchResult result) { result_ = std::move(result); }
+        void unhandled_exception() { exception_ = std::current_exception(); }
+
+        SearchResult result_{};
+        std::exception_ptr exception_{};
+    };
+
+    SearchTask(SearchTask&& other) noexcept : handle_{std::exchange(other.handle_, nullptr)} {}
+    SearchTask& operator=(SearchTask&& other) noexcept
+    {
+        std::swap(handle_, other.handle_);
+        return *this;
+    }
+    SearchTask(const SearchTask&) = delete;
+    SearchTask& operator=(const SearchTask&) = delete;
+    ~SearchTask()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    /// @brief Runs the search for one time slice (unless it is done).
+    void Resume()
+    {
+        if (!IsDone())
+        {
+            handle_.resume();
+        }
+    }
+
+    /// @brief Whether the search finished (or failed, e.g. as calculation was due).
+    bool IsDone() const { return handle_.done(); }
+
+    /// @brief Result of the finished search.
+    ///
+    /// @throws What ended the search prematurely (e.g. CalculationWasDue).
+    const SearchResult& GetResult() const
+    {
+        if (handle_.promise().exception_)
+        {
+            std::rethrow_exception(handle_.promise().exception_);
+        }
+        return handle_.promise().result_;
+    }
+
+  private:
+    explicit SearchTask(const std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/// @brief Searches position like FindBestMove (without forward pruning, see NonRecursiveSearch), but suspends itself
+/// after every nodes_per_time_slice nodes.
+///
+/// All parameters (including the hash history of the game) are copied into the coroutine, which also owns move stack,
+/// search stack and principal variation. So the search can be suspended and resumed later (from anywhere) with its
+/// state intact. (A stop flag given by the abort condition must outlive the search, though.)
+template <typename GenerateBehavior, typename EvaluateBehavior>
+SearchTask FindBestMoveCoroutine(Position position,
+                                 HashHistory hash_history,
+                                 const Evaluation negamax_sign,
+                                 const AbortCondition abort_condition,
+                                 const std::size_t nodes_per_time_slice)
+{
+    MoveStack move_stack{};
+    SearchStack search_stack{};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+
+    NonRecursiveSearch<GenerateBehavior, EvaluateBehavior> search{position,
+                                                                  principal_variation,
+                                                                  hash_history,
+                                                                  search_stack,
+                                                                  move_stack.begin(),
+                                                                  negamax_sign,
+                                                                  abort_condition,
+                                                                  statistic};
+    while (!search.Continue(nodes_per_time_slice))
+    {
+        co_await std::suspend_always{};
+    }
+
+    co_return SearchResult{search.GetEvaluation(), principal_variation.GetMainLine(), statistic};
+}
+
+}  // namespace Chess
+
+#endif
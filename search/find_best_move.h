@@ -1,17 +1,20 @@
 #ifndef SEARCH_FIND_BEST_MOVE_H
 #define SEARCH_FIND_BEST_MOVE_H
 
+#include "bitboard/check_state.h"
+#include "bitboard/copy_make.h"
 #include "bitboard/fen_conversion.h"
 #include "bitboard/move_stack.h"
 #include "bitboard/position.h"
 #include "bitboard/uci_conversion.h"
+#include "evaluate/evaluate.h"
 #include "search/abort_condition.h"
+#include "search/hash_history.h"
 #include "search/material_difference_comparison.h"
 #include "search/principal_variation.h"
 
 #include <algorithm>
 #include <iostream>
-#include <limits>
 #include <tuple>
 #include <type_traits>
 
@@ -23,8 +26,15 @@ std::enable_if_t<EvaluateBehavior::not_defined, Evaluation> Evaluate(const Posit
 
 template <typename GenerateBehavior>
 std::enable_if_t<GenerateBehavior::not_defined, const MoveStack::iterator> GenerateMoves(const Position&,
+                                                                                         const CheckState&,
                                                                                          MoveStack::iterator);
 
+/// @brief Counts the work done by a search.
+struct SearchStatistic
+{
+    std::size_t number_of_nodes{0};
+};
+
 struct DebuggingDisabled
 {
     static constexpr bool debugging = false;
@@ -36,15 +46,16 @@ struct DebuggingEnabled
 };
 
 template <typename Behavior>
-void PrintNodeEntry(const Position& position, const std::size_t depth)
+void PrintNodeEntry(const Position& position, const std::size_t depth, const bool is_expected_cut_node)
 {
     if constexpr (Behavior::debugging)
     {
-        std::cout << "entering depth " << depth << '\n';
+        std::cout << "entering depth " << depth << (is_expected_cut_node ? " (expected cut node)" : "") << '\n';
         PrettyPrintFen(FenFromPosition(position));
     }
     std::ignore = depth;  // Resolve warning if debugging disabled.
     std::ignore = position;
+    std::ignore = is_expected_cut_node;
 }
 
 template <typename Behavior>
@@ -164,44 +175,90 @@ void PrintConsiderationOfPrincipalVariation(const Bitmove move)
     std::ignore = move;  // Resolve warning if debugging disabled.
 }
 
-/// @brief Overwrites current line with next subline (assuming it was evaluated to be better)
-///
-/// Copies line starting at current_depth+1 to current_depth in triangular prinicpal variation table.
-template <typename DebugBehavior>
-inline void PromoteSubline(PrincipalVariation& principal_variation,
-                           const std::size_t current_depth,
-                           const Bitmove current_move)
+/// Nodes with at least this many plies left to search, but without a move suggested by the principal variation, are
+/// first searched with reduced depth to find a good move to search first.
+constexpr std::size_t kInternalIterativeDeepeningMinimumDepth{6};
+constexpr std::size_t kInternalIterativeDeepeningReduction{2};
+
+/// Internal iterative deepening is selected at compile time. Without a hash table it costs more nodes than it saves in
+/// most positions, so it is disabled by default.
+struct InternalIterativeDeepeningDisabled
 {
-    const std::size_t current_move_index = GetSublineIndexAtDepth(current_depth);
-    const std::size_t next_move_of_subline_index = GetSublineIndexAtDepth(current_depth + 1);
-    const std::size_t end_of_subline_index = GetSublineIndexAtDepth(current_depth + 2);
-    const auto begin_of_principal_variation = std::begin(principal_variation);
-    principal_variation[current_move_index] = current_move;
-    std::copy(begin_of_principal_variation + next_move_of_subline_index,
-              begin_of_principal_variation + end_of_subline_index,
-              begin_of_principal_variation + current_move_index + 1);
-}
+    static constexpr bool internal_iterative_deepening = false;
+};
 
-inline void ClearLine(PrincipalVariation& principal_variation, const std::size_t current_depth)
+struct InternalIterativeDeepeningEnabled
 {
-    const std::size_t begin_of_line_index = GetSublineIndexAtDepth(current_depth);
-    const std::size_t end_of_line_index = GetSublineIndexAtDepth(current_depth + 1);
-    std::fill_n(
-        std::begin(principal_variation) + begin_of_line_index, end_of_line_index - begin_of_line_index, kBitNullMove);
-}
+    static constexpr bool internal_iterative_deepening = true;
+};
+
+/// ProbCut: Captures are searched this many plies shallower against beta raised by the margin.
+constexpr std::size_t kProbCutMinimumDepth{5};
+constexpr std::size_t kProbCutReduction{4};
+constexpr Evaluation kProbCutMargin{200};
+
+/// Multi-cut: Of the first moves of an expected cut node, searched this many plies shallower, some need to fail high.
+constexpr std::size_t kMultiCutMinimumDepth{4};
+constexpr std::size_t kMultiCutReduction{2};
+constexpr std::size_t kMultiCutMoves{6};
+constexpr std::size_t kMultiCutRequiredCutoffs{3};
+
+/// Forward pruning may miss the best move in exchange for searching less. It is selected at compile time (e.g. for A/B
+/// comparisons) and never applied to a side in check or against a mate score.
+struct ForwardPruningDisabled
+{
+    static constexpr bool probcut = false;
+    static constexpr bool multi_cut = false;
+};
+
+struct ForwardPruningEnabled
+{
+    static constexpr bool probcut = true;
+    static constexpr bool multi_cut = false;
+};
+
+/// Multi-cut relies on the expected node types to be right and did not save nodes in measurements so far. It is
+/// optional and not part of ForwardPruningEnabled.
+struct ForwardPruningWithMultiCut
+{
+    static constexpr bool probcut = true;
+    static constexpr bool multi_cut = true;
+};
 
 /// @brief A negamax search using alpha/beta pruning.
-template <typename GenerateBehavior, typename EvaluateBehavior, typename DebugBehavior = DebuggingDisabled>
+///
+/// A cutoff is expected at the children of nodes which don't expect one themselves, apart from the first child of a
+/// node on the principal variation. (Only used by multi-cut.)
+///
+/// Children are searched either on the given position or on copies of it (see MakeAndUnmakeMoves and CopyAndMakeMoves).
+template <typename GenerateBehavior,
+          typename EvaluateBehavior,
+          typename DebugBehavior = DebuggingDisabled,
+          typename PruneBehavior = ForwardPruningEnabled,
+          typename MakeBehavior = MakeAndUnmakeMoves,
+          typename DeepeningBehavior = InternalIterativeDeepeningDisabled>
 Evaluation FindBestMove(Position& position,
                         PrincipalVariation& principal_variation,
+                        HashHistory& hash_history,
                         const MoveStack::iterator end_before_move_generation,
                         const Evaluation negamax_sign,
                         const AbortCondition& abort_condition,
+                        SearchStatistic& statistic,
                         const std::size_t current_depth = 0,
-                        const Evaluation parent_negamax_alpha = std::numeric_limits<Evaluation>::lowest(),
-                        const Evaluation parent_negamax_beta = std::numeric_limits<Evaluation>::max())
+                        const Evaluation parent_negamax_alpha = -kInfinity,
+                        const Evaluation parent_negamax_beta = kInfinity,
+                        const bool is_expected_cut_node = false)
 {
-    PrintNodeEntry<DebugBehavior>(position, current_depth);
+    PrintNodeEntry<DebugBehavior>(position, current_depth, is_expected_cut_node);
+    statistic.number_of_nodes++;
+    ThrowIfCalculationIsDue(abort_condition, statistic.number_of_nodes);
+    if ((current_depth > 0) && (hash_history.IsRepetition(position.GetStaticPlies()) || IsDrawByRule(position)))
+    {
+        PrintEvaluation<DebugBehavior>(kDraw);
+        principal_variation.ClearLine(current_depth);
+        PrintNodeExit<DebugBehavior>(current_depth);
+        return kDraw;
+    }
     if (current_depth == abort_condition.full_search_depth)
     {
         const Evaluation minimax_evaluation = Evaluate<EvaluateBehavior>(position);
@@ -210,65 +267,227 @@ Evaluation FindBestMove(Position& position,
         return minimax_evaluation * negamax_sign;
     }
 
+    // Mate distance pruning: No line through this node can be better than mating at the next ply or worse than being
+    // mated right here. If a mate found elsewhere is better than that, this node can't change the result.
+    Evaluation negamax_alpha = std::max(parent_negamax_alpha, MatedIn(current_depth));
+    const Evaluation negamax_beta = std::min(parent_negamax_beta, MateIn(current_depth + 1));
+    if (negamax_alpha >= negamax_beta)
+    {
+        PrintPruningDecision<DebugBehavior>();
+        principal_variation.ClearLine(current_depth);
+        PrintNodeExit<DebugBehavior>(current_depth);
+        return negamax_alpha;
+    }
+
+    const std::size_t remaining_depth = abort_condition.full_search_depth - current_depth;
+    const CheckState check_state = ComputeCheckState(position);
+
+    // ProbCut: If a capture beats beta by a margin even in a shallow search, the full search most likely fails high.
+    if constexpr (PruneBehavior::probcut)
+    {
+        if ((current_depth > 0) && (remaining_depth >= kProbCutMinimumDepth) && !IsMateScore(negamax_beta) &&
+            !check_state.IsInCheck())
+        {
+            const auto probcut_beta = static_cast<Evaluation>(negamax_beta + kProbCutMargin);
+            AbortCondition shallow_abort_condition{abort_condition};
+            shallow_abort_condition.full_search_depth -= kProbCutReduction;
+            const MoveStack::iterator end_after_move_generation =
+                GenerateMoves<GenerateBehavior>(position, check_state, end_before_move_generation);
+            std::sort(end_before_move_generation, end_after_move_generation, IsMaterialDifferenceGreater);
+            for (MoveStack::iterator move_iterator = end_before_move_generation;
+                 move_iterator != end_after_move_generation;
+                 move_iterator++)
+            {
+                const Bitmove current_move = *move_iterator;
+                if (!ExtractCapturedPiece(current_move))
+                {
+                    continue;
+                }
+                Bitboard saved_extras{};
+                Position& child_position =
+                    MakeMoveForChild<MakeBehavior>(position, current_move, current_depth + 1, saved_extras);
+                hash_history.Push(current_move, saved_extras, child_position);
+                const bool is_probcut =
+                    -FindBestMove<GenerateBehavior,
+                                  EvaluateBehavior,
+                                  DebugBehavior,
+                                  PruneBehavior,
+                                  MakeBehavior,
+                                  DeepeningBehavior>(
+                        child_position,
+                        principal_variation,
+                        hash_history,
+                        NextMoveList(end_before_move_generation),
+                        -negamax_sign,
+                        shallow_abort_condition,
+                        statistic,
+                        current_depth + 1,
+                        static_cast<Evaluation>(-probcut_beta),
+                        static_cast<Evaluation>(-probcut_beta + 1)) >= probcut_beta;
+                hash_history.Pop();
+                UnmakeMoveForChild<MakeBehavior>(position, current_move, saved_extras);
+                if (is_probcut)
+                {
+                    PrintPruningDecision<DebugBehavior>();
+                    principal_variation.ClearLine(current_depth);
+                    PrintNodeExit<DebugBehavior>(current_depth);
+                    return negamax_beta;
+                }
+            }
+        }
+    }
+
+    const bool is_inital_entry = (current_depth == 0) && !principal_variation.HasLine(1);
+    const bool is_first_entry_into_current_depth = !principal_variation.HasLine(current_depth);
+    const bool is_move_suggested_by_principal_variation = is_inital_entry || is_first_entry_into_current_depth;
+    Bitmove move_to_search_first{kBitNullMove};
+    if (is_move_suggested_by_principal_variation)
+    {
+        move_to_search_first = principal_variation.GetMove(current_depth);
+        PrintConsiderationOfPrincipalVariation<DebugBehavior>(move_to_search_first);
+    }
+    else if (DeepeningBehavior::internal_iterative_deepening &&
+             (remaining_depth >= kInternalIterativeDeepeningMinimumDepth))
+    {
+        // Internal iterative deepening: Without a suggestion, a search of this node with reduced depth finds the move
+        // to search first. (Its deeper plies reuse the move stack above this node, which is still unused.)
+        AbortCondition reduced_abort_condition{abort_condition};
+        reduced_abort_condition.full_search_depth -= kInternalIterativeDeepeningReduction;
+        const Evaluation reduced_negamax_evaluation =
+            FindBestMove<GenerateBehavior,
+                         EvaluateBehavior,
+                         DebugBehavior,
+                         PruneBehavior,
+                         MakeBehavior,
+                         DeepeningBehavior>(
+                position,
+                principal_variation,
+                hash_history,
+                end_before_move_generation,
+                negamax_sign,
+                reduced_abort_condition,
+                statistic,
+                current_depth,
+                negamax_alpha,
+                negamax_beta,
+                is_expected_cut_node);
+        if ((reduced_negamax_evaluation > negamax_alpha) && principal_variation.HasLine(current_depth))
+        {
+            move_to_search_first = principal_variation.GetLine(current_depth).moves.front();
+        }
+    }
+
     const MoveStack::iterator end_after_move_generation =
-        GenerateMoves<GenerateBehavior>(position, end_before_move_generation);
+        GenerateMoves<GenerateBehavior>(position, check_state, end_before_move_generation);
     std::sort(end_before_move_generation, end_after_move_generation, IsMaterialDifferenceGreater);
-    const bool is_inital_entry =
-        (current_depth == 0) && (principal_variation[GetSublineIndexAtDepth(1)] == kBitNullMove);
-    const bool is_first_entry_into_current_depth{principal_variation[GetSublineIndexAtDepth(current_depth)] ==
-                                                 kBitNullMove};
-    if (is_inital_entry || is_first_entry_into_current_depth)
+    if (is_move_suggested_by_principal_variation || (move_to_search_first != kBitNullMove))
     {
-        PrintConsiderationOfPrincipalVariation<DebugBehavior>(principal_variation[current_depth]);
-        const auto IsMoveSuggestedByPrincipalVariation = [&principal_variation, &current_depth](const auto a,
-                                                                                                const auto b) {
+        const auto IsMoveToSearchFirst = [move_to_search_first](const auto a, const auto b) {
             std::ignore = b;
-            return a == principal_variation[current_depth];
+            return a == move_to_search_first;
         };
-        std::sort(end_before_move_generation, end_after_move_generation, IsMoveSuggestedByPrincipalVariation);
+        std::sort(end_before_move_generation, end_after_move_generation, IsMoveToSearchFirst);
     }
     PrintGeneratedMoves<DebugBehavior>(end_before_move_generation, end_after_move_generation);
 
-    Evaluation negamax_alpha = parent_negamax_alpha;
+    // Multi-cut: If several of the first moves of an expected cut node fail high even in a reduced search, the full
+    // search most likely fails high as well.
+    if constexpr (PruneBehavior::multi_cut)
+    {
+        if (is_expected_cut_node && (remaining_depth >= kMultiCutMinimumDepth) && !IsMateScore(negamax_beta) &&
+            !check_state.IsInCheck())
+        {
+            AbortCondition reduced_abort_condition{abort_condition};
+            reduced_abort_condition.full_search_depth -= kMultiCutReduction;
+            std::size_t number_of_searched_moves{0};
+            std::size_t number_of_cutoffs{0};
+            for (MoveStack::iterator move_iterator = end_before_move_generation;
+                 (move_iterator != end_after_move_generation) && (number_of_searched_moves < kMultiCutMoves);
+                 move_iterator++)
+            {
+                const Bitmove current_move = *move_iterator;
+                number_of_searched_moves++;
+                Bitboard saved_extras{};
+                Position& child_position =
+                    MakeMoveForChild<MakeBehavior>(position, current_move, current_depth + 1, saved_extras);
+                hash_history.Push(current_move, saved_extras, child_position);
+                const Evaluation negamax_evaluation =
+                    -FindBestMove<GenerateBehavior,
+                                  EvaluateBehavior,
+                                  DebugBehavior,
+                                  PruneBehavior,
+                                  MakeBehavior,
+                                  DeepeningBehavior>(
+                        child_position,
+                        principal_variation,
+                        hash_history,
+                        NextMoveList(end_before_move_generation),
+                        -negamax_sign,
+                        reduced_abort_condition,
+                        statistic,
+                        current_depth + 1,
+                        static_cast<Evaluation>(-negamax_beta),
+                        static_cast<Evaluation>(-negamax_beta + 1));
+                hash_history.Pop();
+                UnmakeMoveForChild<MakeBehavior>(position, current_move, saved_extras);
+                number_of_cutoffs += (negamax_evaluation >= negamax_beta) ? 1 : 0;
+                if (number_of_cutoffs == kMultiCutRequiredCutoffs)
+                {
+                    PrintPruningDecision<DebugBehavior>();
+                    principal_variation.ClearLine(current_depth);
+                    PrintNodeExit<DebugBehavior>(current_depth);
+                    return negamax_beta;
+                }
+            }
+        }
+    }
+
     bool is_terminal_node = true;
 
     for (MoveStack::iterator move_iterator = end_before_move_generation; move_iterator != end_after_move_generation;
          move_iterator++)
     {
         const Bitmove current_move = *move_iterator;
-        const Bitboard saved_extras = position.MakeMove(current_move);
-        if (!position.IsKingInCheck(position.defending_side_))
-        {
-            PrintMoveInvestigation<DebugBehavior>(end_before_move_generation, move_iterator, end_after_move_generation);
-            is_terminal_node = false;
-            Evaluation negamax_evaluation =
-                -FindBestMove<GenerateBehavior, EvaluateBehavior, DebugBehavior>(position,
-                                                                                 principal_variation,
-                                                                                 end_after_move_generation,
-                                                                                 -negamax_sign,
-                                                                                 abort_condition,
-                                                                                 current_depth + 1,
-                                                                                 -parent_negamax_beta,
-                                                                                 -negamax_alpha);
-            PrintMoveResult<DebugBehavior>(*move_iterator, negamax_evaluation * negamax_sign);
-
-            if (negamax_evaluation > negamax_alpha)
-            {
-                negamax_alpha = negamax_evaluation;
-                PromoteSubline<DebugBehavior>(principal_variation, current_depth, current_move);
-                PrintPrincipalVariation<DebugBehavior>(principal_variation, current_depth, current_move);
-            }
+        Bitboard saved_extras{};
+        Position& child_position =
+            MakeMoveForChild<MakeBehavior>(position, current_move, current_depth + 1, saved_extras);
+        PrintMoveInvestigation<DebugBehavior>(end_before_move_generation, move_iterator, end_after_move_generation);
+        const bool is_first_child_on_principal_variation = is_move_suggested_by_principal_variation && is_terminal_node;
+        is_terminal_node = false;
+        hash_history.Push(current_move, saved_extras, child_position);
+        Evaluation negamax_evaluation =
+            -FindBestMove<GenerateBehavior,
+                          EvaluateBehavior,
+                          DebugBehavior,
+                          PruneBehavior,
+                          MakeBehavior,
+                          DeepeningBehavior>(
+                child_position,
+                principal_variation,
+                hash_history,
+                NextMoveList(end_before_move_generation),
+                -negamax_sign,
+                abort_condition,
+                statistic,
+                current_depth + 1,
+                -negamax_beta,
+                -negamax_alpha,
+                !is_expected_cut_node && !is_first_child_on_principal_variation);
+        hash_history.Pop();
+        PrintMoveResult<DebugBehavior>(*move_iterator, negamax_evaluation * negamax_sign);
 
-            PrintPruningInfo<DebugBehavior>(negamax_alpha, parent_negamax_beta, negamax_sign);
+        if (negamax_evaluation > negamax_alpha)
+        {
+            negamax_alpha = negamax_evaluation;
+            principal_variation.PromoteSubline(current_depth, current_move);
+            PrintPrincipalVariation<DebugBehavior>(principal_variation, current_depth, current_move);
         }
-        position.UnmakeMove(current_move, saved_extras);
 
-        if (negamax_alpha >= parent_negamax_beta)
+        PrintPruningInfo<DebugBehavior>(negamax_alpha, negamax_beta, negamax_sign);
+        UnmakeMoveForChild<MakeBehavior>(position, current_move, saved_extras);
+
+        if (negamax_alpha >= negamax_beta)
         {
-            if (std::chrono::steady_clock::now() > abort_condition.calculation_is_due)
-            {
-                throw CalculationWasDue{};
-            }
             PrintPruningDecision<DebugBehavior>();
             break;
         }
@@ -276,9 +495,9 @@ Evaluation FindBestMove(Position& position,
 
     if (is_terminal_node)
     {
-        negamax_alpha = DetermineGameResult(position, current_depth);
+        negamax_alpha = DetermineGameResult(check_state, current_depth);
         PrintEvaluation<DebugBehavior>(negamax_alpha * negamax_sign);
-        ClearLine(principal_variation, current_depth);
+        principal_variation.ClearLine(current_depth);
     }
 
     PrintNodeExit<DebugBehavior>(current_depth);
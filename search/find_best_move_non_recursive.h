@@ -0,0 +1,270 @@
+#ifndef SEARCH_FIND_BEST_MOVE_NON_RECURSIVE_H
+#define SEARCH_FIND_BEST_MOVE_NON_RECURSIVE_H
+
+#include "bitboard/check_state.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/position.h"
+#include "search/abort_condition.h"
+#include "search/find_best_move.h"
+#include "search/hash_history.h"
+#include "search/material_difference_comparison.h"
+#include "search/principal_variation.h"
+#include "search/search_stack.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace Chess
+{
+
+/// @brief The negamax search of FindBestMove with the recursion replaced by an explicit SearchStack.
+///
+/// Visits the same nodes in the same order and yields the same evaluation and principal variation as FindBestMove
+/// without forward pruning (ForwardPruningDisabled) and debugging output, given the same DeepeningBehavior. As the
+/// whole state of the search lives in this object, search_stack, position, hash history and move stack, the search is
+/// not bound to the call stack. It can be continued node by node (e.g. to suspend and resume it or for split points).
+template <typename GenerateBehavior,
+          typename EvaluateBehavior,
+          typename DeepeningBehavior = InternalIterativeDeepeningDisabled>
+class NonRecursiveSearch
+{
+  public:
+    /// @throws std::out_of_range if the full search depth exceeds the search stack.
+    NonRecursiveSearch(Position& position,
+                       PrincipalVariation& principal_variation,
+                       HashHistory& hash_history,
+                       SearchStack& search_stack,
+                       const MoveStack::iterator end_before_move_generation,
+                       const Evaluation negamax_sign,
+                       const AbortCondition& abort_condition,
+                       SearchStatistic& statistic)
+        : position_{position},
+          principal_variation_{principal_variation},
+          hash_history_{hash_history},
+          search_stack_{search_stack},
+          abort_condition_{abort_condition},
+          statistic_{statistic}
+    {
+        if (abort_condition.full_search_depth >= search_stack.size())
+        {
+            throw std::out_of_range{"Search depth " + std::to_string(abort_condition.full_search_depth) +
+                                    " exceeds the search stack."};
+        }
+        search_stack_.front() = SearchFrame{};
+        search_stack_.front().end_before_move_generation = end_before_move_generation;
+        search_stack_.front().negamax_sign = negamax_sign;
+        search_stack_.front().full_search_depth = abort_condition.full_search_depth;
+    }
+
+    /// @brief Continues the search until it is finished or entered the given number of further nodes.
+    ///
+    /// @returns Whether the search is finished.
+    bool Continue(const std::size_t number_of_nodes = std::numeric_limits<std::size_t>::max())
+    {
+        std::size_t number_of_entered_nodes{0};
+        while (!is_finished_)
+        {
+            if (is_entering_node_ && (number_of_entered_nodes == number_of_nodes))
+            {
+                return false;
+            }
+            number_of_entered_nodes += is_entering_node_ ? 1 : 0;
+            Step();
+        }
+        return true;
+    }
+
+    /// @brief Negamax evaluation of the root (once the search is finished).
+    Evaluation GetEvaluation() const { return negamax_evaluation_of_child_; }
+
+  private:
+    /// @brief Enters a node or returns to it from a child, then descends into the next child or leaves the node.
+    void Step()
+    {
+        SearchFrame& frame = search_stack_[current_depth_];
+
+        if (is_entering_node_)
+        {
+            statistic_.number_of_nodes++;
+            ThrowIfCalculationIsDue(abort_condition_, statistic_.number_of_nodes);
+            if ((current_depth_ > 0) &&
+                (hash_history_.IsRepetition(position_.GetStaticPlies()) || IsDrawByRule(position_)))
+            {
+                principal_variation_.ClearLine(current_depth_);
+                LeaveNode(kDraw);
+                return;
+            }
+            if (current_depth_ == frame.full_search_depth)
+            {
+                LeaveNode(Evaluate<EvaluateBehavior>(position_) * frame.negamax_sign);
+                return;
+            }
+
+            frame.negamax_alpha = std::max(frame.negamax_alpha, MatedIn(current_depth_));  // mate distance pruning
+            frame.negamax_beta = std::min(frame.negamax_beta, MateIn(current_depth_ + 1));
+            if (frame.negamax_alpha >= frame.negamax_beta)
+            {
+                principal_variation_.ClearLine(current_depth_);
+                LeaveNode(frame.negamax_alpha);
+                return;
+            }
+
+            const bool is_inital_entry = (current_depth_ == 0) && !principal_variation_.HasLine(1);
+            const bool is_first_entry_into_current_depth = !principal_variation_.HasLine(current_depth_);
+            if (is_inital_entry || is_first_entry_into_current_depth)
+            {
+                frame.move_to_search_first = principal_variation_.GetMove(current_depth_);
+            }
+            else if (DeepeningBehavior::internal_iterative_deepening &&
+                     (frame.full_search_depth - current_depth_ >= kInternalIterativeDeepeningMinimumDepth))
+            {
+                // Internal iterative deepening: Enters this node once more (like the nested call of FindBestMove), but
+                // with reduced depth. Its result is picked up in StartNextSearchOfNode.
+                frame.full_search_depth -= kInternalIterativeDeepeningReduction;
+                frame.number_of_reduced_searches_left++;
+                return;
+            }
+            frame.initial_negamax_alpha = frame.negamax_alpha;
+            frame.check_state = ComputeCheckState(position_);
+            GenerateAndSortMoves(frame, is_inital_entry || is_first_entry_into_current_depth);
+        }
+        else
+        {
+            const Evaluation negamax_evaluation = -negamax_evaluation_of_child_;
+            if (negamax_evaluation > frame.negamax_alpha)
+            {
+                frame.negamax_alpha = negamax_evaluation;
+                principal_variation_.PromoteSubline(current_depth_, frame.current_move);
+            }
+            hash_history_.Pop();
+            position_.UnmakeMove(frame.current_move, frame.saved_extras);
+            frame.move_iterator++;
+        }
+
+        while (!DescendIntoNextChild(frame))
+        {
+            if (frame.is_terminal_node)
+            {
+                frame.negamax_alpha = DetermineGameResult(frame.check_state, current_depth_);
+                principal_variation_.ClearLine(current_depth_);
+            }
+            if (frame.number_of_reduced_searches_left == 0)
+            {
+                LeaveNode(frame.negamax_alpha);
+                return;
+            }
+            StartNextSearchOfNode(frame);
+        }
+    }
+
+    /// @returns Whether a child was entered, i.e. false if all moves are searched or a cutoff occurred.
+    bool DescendIntoNextChild(SearchFrame& frame)
+    {
+        if ((frame.negamax_alpha < frame.negamax_beta) && (frame.move_iterator != frame.end_after_move_generation))
+        {
+            frame.current_move = *frame.move_iterator;
+            frame.saved_extras = position_.MakeMove(frame.current_move);
+            frame.is_terminal_node = false;
+            hash_history_.Push(frame.current_move, frame.saved_extras, position_);
+            SearchFrame& child = search_stack_[current_depth_ + 1];
+            child.end_before_move_generation = NextMoveList(frame.end_before_move_generation);
+            child.negamax_sign = -frame.negamax_sign;
+            child.negamax_alpha = -frame.negamax_beta;
+            child.negamax_beta = -frame.negamax_alpha;
+            child.full_search_depth = frame.full_search_depth;
+            child.number_of_reduced_searches_left = 0;
+            child.move_to_search_first = kBitNullMove;
+            current_depth_++;
+            is_entering_node_ = true;
+            return true;
+        }
+        return false;
+    }
+
+    void GenerateAndSortMoves(SearchFrame& frame, const bool is_move_suggested_by_principal_variation)
+    {
+        frame.end_after_move_generation =
+            GenerateMoves<GenerateBehavior>(position_, frame.check_state, frame.end_before_move_generation);
+        std::sort(frame.end_before_move_generation, frame.end_after_move_generation, IsMaterialDifferenceGreater);
+        if (is_move_suggested_by_principal_variation || (frame.move_to_search_first != kBitNullMove))
+        {
+            std::sort(frame.end_before_move_generation,
+                      frame.end_after_move_generation,
+                      [move_to_search_first = frame.move_to_search_first](const auto a, const auto) {
+                          return a == move_to_search_first;
+                      });
+        }
+        frame.move_iterator = frame.end_before_move_generation;
+        frame.is_terminal_node = true;
+    }
+
+    /// @brief Finishes a reduced search of internal iterative deepening and starts the next deeper one.
+    void StartNextSearchOfNode(SearchFrame& frame)
+    {
+        const bool has_found_move = (frame.negamax_alpha > frame.initial_negamax_alpha) &&
+                                    principal_variation_.HasLine(current_depth_);
+        frame.move_to_search_first =
+            has_found_move ? principal_variation_.GetLine(current_depth_).moves.front() : kBitNullMove;
+        frame.negamax_alpha = frame.initial_negamax_alpha;
+        frame.full_search_depth += kInternalIterativeDeepeningReduction;
+        frame.number_of_reduced_searches_left--;
+        GenerateAndSortMoves(frame, false);
+    }
+
+    void LeaveNode(const Evaluation negamax_evaluation)
+    {
+        negamax_evaluation_of_child_ = negamax_evaluation;
+        is_entering_node_ = false;
+        if (current_depth_ == 0)
+        {
+            is_finished_ = true;
+            return;
+        }
+        current_depth_--;
+    }
+
+    Position& position_;
+    PrincipalVariation& principal_variation_;
+    HashHistory& hash_history_;
+    SearchStack& search_stack_;
+    const AbortCondition& abort_condition_;
+    SearchStatistic& statistic_;
+
+    std::size_t current_depth_{0};
+    bool is_entering_node_{true};
+    bool is_finished_{false};
+    Evaluation negamax_evaluation_of_child_{};  // once finished, the evaluation of the root
+};
+
+/// @brief Runs a NonRecursiveSearch until it is finished.
+///
+/// @throws std::out_of_range if the full search depth exceeds the search stack.
+template <typename GenerateBehavior,
+          typename EvaluateBehavior,
+          typename DeepeningBehavior = InternalIterativeDeepeningDisabled>
+Evaluation FindBestMoveNonRecursive(Position& position,
+                                    PrincipalVariation& principal_variation,
+                                    HashHistory& hash_history,
+                                    SearchStack& search_stack,
+                                    const MoveStack::iterator end_before_move_generation,
+                                    const Evaluation negamax_sign,
+                                    const AbortCondition& abort_condition,
+                                    SearchStatistic& statistic)
+{
+    NonRecursiveSearch<GenerateBehavior, EvaluateBehavior, DeepeningBehavior> search{position,
+                                                                                     principal_variation,
+                                                                                     hash_history,
+                                                                                     search_stack,
+                                                                                     end_before_move_generation,
+                                                                                     negamax_sign,
+                                                                                     abort_condition,
+                                                                                     statistic};
+    search.Continue();
+    return search.GetEvaluation();
+}
+
+}  // namespace Chess
+
+#endif
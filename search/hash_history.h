@@ -0,0 +1,61 @@
+#ifndef SEARCH_HASH_HISTORY_H
+#define SEARCH_HASH_HISTORY_H
+
+#include "bitboard/position.h"
+#include "bitboard/zobrist.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Chess
+{
+
+/// @brief Stack of the keys of all positions of the game so far followed by those of the currently searched path.
+///
+/// The key of the current position is always on top.
+class HashHistory
+{
+  public:
+    explicit HashHistory(const Position& position) : keys_{ComputeZobristKey(position)}
+    {
+        keys_.reserve(kReservedNumberOfKeys);
+    }
+
+    /// @brief Adds the key of the position reached by move. (Called right after Position::MakeMove.)
+    void Push(const Bitmove move, const Bitboard extras_before_move, const Position& position_after_move)
+    {
+        keys_.push_back(UpdateZobristKey(keys_.back(), move, extras_before_move, position_after_move));
+    }
+
+    /// @brief Removes the key of the current position. (Called along with Position::UnmakeMove.)
+    void Pop() { keys_.pop_back(); }
+
+    ZobristKey GetCurrentKey() const { return keys_.back(); }
+
+    /// @brief Whether the current position occurred before.
+    ///
+    /// Only the given number of plies is scanned, as no position can repeat across an irreversible move (pawn move or
+    /// capture). Positions with the other side to move are skipped, just like the two plies before (which can't match).
+    bool IsRepetition(const std::size_t reversible_plies) const
+    {
+        const std::size_t plies_to_scan = std::min(reversible_plies, keys_.size() - 1);
+        const auto current_key = keys_.rbegin();
+        for (std::size_t plies_back{4}; plies_back <= plies_to_scan; plies_back += 2)
+        {
+            if (*(current_key + plies_back) == *current_key)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    static constexpr std::size_t kReservedNumberOfKeys{1024};
+
+    std::vector<ZobristKey> keys_{};
+};
+
+}  // namespace Chess
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef SEARCH_ITERATIVE_DEEPENING_H
+#define SEARCH_ITERATIVE_DEEPENING_H
+
+#include "bitboard/move_stack.h"
+#include "bitboard/position.h"
+#include "search/abort_condition.h"
+#include "search/find_best_move.h"
+#include "search/hash_history.h"
+#include "search/principal_variation.h"
+#include "search/root_moves.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace Chess
+{
+
+/// @brief Outcome of a single completed iteration of iterative deepening.
+struct IterationResult
+{
+    std::size_t depth{0};
+    Bitmove best_move{kBitNullMove};
+    Evaluation evaluation{0};  // in negamax notation, i.e. from the perspective of the side to move
+    std::size_t number_of_nodes{0};
+    std::chrono::microseconds duration{0};
+
+    /// The best lines in decreasing order, each with its evaluation and principal variation. (More than one in MultiPV
+    /// mode, none if there is no legal move.)
+    RootMoves lines{};
+};
+
+using ReportIteration = std::function<void(const IterationResult&)>;
+
+/// @brief Predicts the duration of the next iteration from the observed effective branching factor.
+///
+/// The effective branching factor is the ratio of nodes needed by the last two iterations. Returns zero if there is
+/// not enough data for a prediction yet.
+inline std::chrono::microseconds PredictDurationOfNextIteration(const std::vector<IterationResult>& iterations)
+{
+    if (iterations.size() < 2)
+    {
+        return std::chrono::microseconds{0};
+    }
+    const IterationResult& last = iterations.back();
+    const IterationResult& second_to_last = iterations[iterations.size() - 2];
+    const std::size_t nodes_of_second_to_last = std::max(second_to_last.number_of_nodes, std::size_t{1});
+    const double effective_branching_factor =
+        static_cast<double>(last.number_of_nodes) / static_cast<double>(nodes_of_second_to_last);
+    return std::chrono::microseconds{static_cast<long>(last.duration.count() * effective_branching_factor)};
+}
+
+/// @brief Searches the best number_of_lines lines one after another. Each pass excludes the best moves of its
+/// predecessors (MultiPV).
+///
+/// Every pass is seeded with the line found at its place by the previous iteration for move ordering. Afterwards the
+/// main line of principal_variation is the best line.
+///
+/// @returns The evaluation of the best line.
+template <typename GenerateBehavior, typename EvaluateBehavior>
+Evaluation SearchBestLines(Position& position,
+                           PrincipalVariation& principal_variation,
+                           HashHistory& hash_history,
+                           RootMoves& root_moves,
+                           const std::size_t number_of_lines,
+                           const MoveStack::iterator end_before_move_generation,
+                           const Evaluation negamax_sign,
+                           const AbortCondition& abort_condition,
+                           SearchStatistic& statistic)
+{
+    if (root_moves.empty())
+    {
+        return SearchRootMoves<GenerateBehavior, EvaluateBehavior>(position,
+                                                                   principal_variation,
+                                                                   hash_history,
+                                                                   begin(root_moves),
+                                                                   end(root_moves),
+                                                                   end_before_move_generation,
+                                                                   negamax_sign,
+                                                                   abort_condition,
+                                                                   statistic);
+    }
+
+    Evaluation evaluation_of_best_line{};
+    const std::size_t number_of_searched_lines = std::clamp(number_of_lines, std::size_t{1}, root_moves.size());
+    for (std::size_t line{0}; line < number_of_searched_lines; line++)
+    {
+        const RootMoves::iterator first = begin(root_moves) + line;
+        principal_variation.SetMainLine(first->principal_variation);
+        const Evaluation evaluation = SearchRootMoves<GenerateBehavior, EvaluateBehavior>(position,
+                                                                                          principal_variation,
+                                                                                          hash_history,
+                                                                                          first,
+                                                                                          end(root_moves),
+                                                                                          end_before_move_generation,
+                                                                                          negamax_sign,
+                                                                                          abort_condition,
+                                                                                          statistic);
+        first->principal_variation = principal_variation.GetMainLine();
+        if (line == 0)
+        {
+            evaluation_of_best_line = evaluation;
+        }
+    }
+
+    principal_variation.SetMainLine(root_moves.front().principal_variation);
+    return evaluation_of_best_line;
+}
+
+/// @brief Searches the position to increasing depth, starting at 1, until the abort condition is met.
+///
+/// Every iteration benefits from its predecessor for move ordering: at the root by subtree sizes (see SortRootMoves),
+/// below by the principal variation. If an iteration is interrupted, position, hash history, principal variation and
+/// root moves are restored to the state after the last completed iteration. Only the first iteration is never
+/// interrupted, as it is cheap and the only source of a best move. An iteration is not started if it is predicted not
+/// to finish before calculation is due.
+/// Every completed iteration is handed to report_iteration (if given), e.g. to inform the gui about progress.
+///
+/// @returns The results of all completed iterations (the best move is taken from the last one).
+template <typename GenerateBehavior, typename EvaluateBehavior>
+std::vector<IterationResult> IterativeDeepening(Position& position,
+                                                PrincipalVariation& principal_variation,
+                                                HashHistory& hash_history,
+                                                RootMoves& root_moves,
+                                                const MoveStack::iterator end_before_move_generation,
+                                                const Evaluation negamax_sign,
+                                                AbortCondition abort_condition,
+                                                SearchStatistic& statistic,
+                                                const std::size_t number_of_lines = 1,
+                                                const ReportIteration& report_iteration = {})
+{
+    const Position position_prior = position;
+    const HashHistory hash_history_prior = hash_history;
+    std::vector<Bitmove> main_line_of_last_completed_iteration = principal_variation.GetMainLine();
+    RootMoves root_moves_of_last_completed_iteration = root_moves;
+    std::vector<IterationResult> iterations{};
+
+    for (abort_condition.full_search_depth = 1;
+         abort_condition.full_search_depth <= abort_condition.maximum_search_depth;
+         abort_condition.full_search_depth++)
+    {
+        const auto begin_of_iteration = std::chrono::steady_clock::now();
+        const std::size_t number_of_nodes_before_iteration = statistic.number_of_nodes;
+
+        AbortCondition abort_condition_of_iteration{abort_condition};
+        if (abort_condition.full_search_depth == 1)
+        {
+            abort_condition_of_iteration.calculation_is_due = std::chrono::steady_clock::time_point::max();
+            abort_condition_of_iteration.stop_requested = nullptr;
+            abort_condition_of_iteration.node_limit = std::numeric_limits<std::size_t>::max();
+        }
+
+        Evaluation evaluation{};
+        try
+        {
+            evaluation = SearchBestLines<GenerateBehavior, EvaluateBehavior>(position,
+                                                                             principal_variation,
+                                                                             hash_history,
+                                                                             root_moves,
+                                                                             number_of_lines,
+                                                                             end_before_move_generation,
+                                                                             negamax_sign,
+                                                                             abort_condition_of_iteration,
+                                                                             statistic);
+        }
+        catch (const CalculationWasDue&)
+        {
+            position = position_prior;
+            hash_history = hash_history_prior;
+            principal_variation.SetMainLine(main_line_of_last_completed_iteration);
+            root_moves = root_moves_of_last_completed_iteration;
+            break;
+        }
+
+        const auto end_of_iteration = std::chrono::steady_clock::now();
+        const std::size_t number_of_best_lines = std::min(std::max(number_of_lines, std::size_t{1}), root_moves.size());
+        iterations.push_back(
+            {abort_condition.full_search_depth,
+             principal_variation.GetMove(0),
+             evaluation,
+             statistic.number_of_nodes - number_of_nodes_before_iteration,
+             std::chrono::duration_cast<std::chrono::microseconds>(end_of_iteration - begin_of_iteration),
+             {begin(root_moves), begin(root_moves) + number_of_best_lines}});
+        principal_variation.ClearSublines();
+        SortRootMoves(root_moves, number_of_best_lines);
+        main_line_of_last_completed_iteration = principal_variation.GetMainLine();
+        root_moves_of_last_completed_iteration = root_moves;
+        if (report_iteration)
+        {
+            report_iteration(iterations.back());
+        }
+
+        const bool next_iteration_would_be_due =
+            (abort_condition.calculation_is_due != std::chrono::steady_clock::time_point::max()) &&
+            (end_of_iteration + PredictDurationOfNextIteration(iterations) > abort_condition.calculation_is_due);
+        if (next_iteration_would_be_due)
+        {
+            break;
+        }
+    }
+
+    return iterations;
+}
+
+}  // namespace Chess
+
+#endif
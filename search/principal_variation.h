@@ -5,38 +5,99 @@
 #include "bitboard/move.h"
 #include "bitboard/uci_conversion.h"
 
+#include <algorithm>
 #include <array>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace Chess
 {
 
-static constexpr std::size_t kMaximumLengthOfPrincipalVariation{20};
+static constexpr std::size_t kMaximumLengthOfPrincipalVariation{128};
 
-/// @brief The principal variation is stored as a triangular table.
-///
-/// It has space for the best line and all currently investigated sublines.
-/// The table is concatenated to a single array. Its necessary length corresponds to the triangular number of the
-/// maximum allowed search depth.
-using PrincipalVariation =
-    std::array<Bitmove, kMaximumLengthOfPrincipalVariation*(kMaximumLengthOfPrincipalVariation + 1) / 2>;
-
-// TODO: Calculate at compile time
-// Taken from https://www.chessprogramming.org/Triangular_PV-Table
-/// @brief This helper function returns the index where the subline at given depth can be accessed in the
-/// (logically triangular but in memory concatenated) principal variation table.
-inline constexpr std::size_t GetSublineIndexAtDepth(const std::size_t depth)
+/// @brief The best continuation found (so far) below a node.
+struct PrincipalVariationLine
 {
-    return depth * (2 * kMaximumLengthOfPrincipalVariation + 1 - depth) / 2;
-}
+    std::array<Bitmove, kMaximumLengthOfPrincipalVariation> moves{};
+    std::size_t length{0};
+};
 
-inline void ClearSublines(PrincipalVariation& principal_variation)
+/// @brief The principal variation is stored as a stack of lines, one per ply.
+///
+/// The line at a ply holds the best continuation found by the node at this ply of the currently searched path. The
+/// line at ply 0 is the main line. Promoting a move at a ply prepends it to the line one ply below, which copies only
+/// the actual length of that line.
+class PrincipalVariation
 {
-    constexpr std::size_t index_after_principal_variation = GetSublineIndexAtDepth(1);
-    constexpr std::size_t number_of_elements_to_clear = principal_variation.size() - index_after_principal_variation;
-    std::fill_n(
-        std::begin(principal_variation) + index_after_principal_variation, number_of_elements_to_clear, kBitNullMove);
-}
+  public:
+    /// @brief Move of the main line at ply, the null move beyond its end.
+    ///
+    /// @throws std::out_of_range if ply is beyond kMaximumLengthOfPrincipalVariation.
+    Bitmove GetMove(const std::size_t ply) const
+    {
+        if (ply >= kMaximumLengthOfPrincipalVariation)
+        {
+            throw std::out_of_range{"Ply " + std::to_string(ply) + " is beyond the principal variation."};
+        }
+        const PrincipalVariationLine& main_line = lines_.front();
+        return ply < main_line.length ? main_line.moves[ply] : kBitNullMove;
+    }
+
+    /// @throws std::out_of_range if ply is beyond kMaximumLengthOfPrincipalVariation.
+    const PrincipalVariationLine& GetLine(const std::size_t ply) const { return lines_.at(ply); }
+
+    /// @brief Whether the node at ply already found a line (since the line was cleared).
+    bool HasLine(const std::size_t ply) const { return GetLine(ply).length > 0; }
+
+    /// @brief Overwrites the line at ply with move followed by the line at the next ply (as move was evaluated to be
+    /// better).
+    ///
+    /// @throws std::out_of_range if ply is the last ply that can be stored.
+    void PromoteSubline(const std::size_t ply, const Bitmove move)
+    {
+        const PrincipalVariationLine& subline = lines_.at(ply + 1);
+        PrincipalVariationLine& line = lines_[ply];
+        const std::size_t length_of_subline = std::min(subline.length, kMaximumLengthOfPrincipalVariation - 1);
+        line.moves.front() = move;
+        std::copy_n(std::begin(subline.moves), length_of_subline, std::begin(line.moves) + 1);
+        line.length = length_of_subline + 1;
+    }
+
+    void ClearLine(const std::size_t ply) { lines_.at(ply).length = 0; }
+
+    /// @brief Clears all lines but the main line, e.g. to use the main line as move ordering hint for the next
+    /// iteration.
+    void ClearSublines()
+    {
+        std::for_each(std::begin(lines_) + 1, std::end(lines_), [](auto& line) { line.length = 0; });
+    }
+
+    void Clear()
+    {
+        std::for_each(std::begin(lines_), std::end(lines_), [](auto& line) { line.length = 0; });
+    }
+
+    std::vector<Bitmove> GetMainLine() const
+    {
+        const PrincipalVariationLine& main_line = lines_.front();
+        return {std::begin(main_line.moves), std::begin(main_line.moves) + main_line.length};
+    }
+
+    /// @brief Replaces all lines by the given main line (e.g. to resume search of a line found earlier).
+    void SetMainLine(const std::vector<Bitmove>& main_line)
+    {
+        Clear();
+        PrincipalVariationLine& line = lines_.front();
+        line.length = std::min(main_line.size(), kMaximumLengthOfPrincipalVariation);
+        std::copy_n(std::begin(main_line), line.length, std::begin(line.moves));
+    }
+
+  private:
+    /// One more line than plies, as the line below the deepest ply is read (and empty) when promoting at that ply.
+    std::array<PrincipalVariationLine, kMaximumLengthOfPrincipalVariation + 1> lines_{};
+};
 
 inline std::string ToString(const PrincipalVariation& principal_variation)
 {
@@ -46,33 +107,34 @@ inline std::string ToString(const PrincipalVariation& principal_variation)
 
     std::stringstream stream{};
 
-    int line{0};  // 0 is the main line, 1 the subline after first move of main line, etc.
-    for (std::size_t index{0}; index < principal_variation.size(); index++)
+    for (std::size_t ply{0}; ply < kMaximumLengthOfPrincipalVariation; ply++)
     {
-        const bool end_of_line_reached = (index == GetSublineIndexAtDepth(line + 1));
-        if (end_of_line_reached)
+        const PrincipalVariationLine& line = principal_variation.GetLine(ply);
+        if ((ply > 0) && (line.length == 0))
         {
-            const bool is_main_line{line == 0};
-            if (is_main_line)
-            {
-                stream << "(main line)";
-            }
-            line++;
-            stream << '\n';
-            for (int count{0}; count < line; count++)
+            continue;
+        }
+
+        for (std::size_t count{0}; count < ply; count++)
+        {
+            stream << uci_move_placeholder_with_max_length << separator;
+        }
+        for (std::size_t index{0}; index < line.length; index++)
+        {
+            const std::string uci_move{ToUciString(line.moves[index])};
+            stream << uci_move << separator;
+            const bool is_move_without_promotion{uci_move.size() == 4};
+            if (is_move_without_promotion)
             {
-                stream << uci_move_placeholder_with_max_length << separator;
+                stream << empty_promotion;  // Make sure printout is aligned for promotions, too.
             }
         }
-        const std::string uci_move{ToUciString(principal_variation[index])};
-        stream << uci_move << separator;
-        const bool is_move_without_promotion{uci_move.size() == 4};
-        if (is_move_without_promotion)
+        if (ply == 0)
         {
-            stream << empty_promotion;  // Make sure printout is aligned for promotions, too.
+            stream << "(main line)";
         }
+        stream << '\n';
     }
-    stream << '\n';
 
     return stream.str();
 }
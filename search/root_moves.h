@@ -0,0 +1,136 @@
+#ifndef SEARCH_ROOT_MOVES_H
+#define SEARCH_ROOT_MOVES_H
+
+#include "bitboard/check_state.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/position.h"
+#include "search/abort_condition.h"
+#include "search/find_best_move.h"
+#include "search/hash_history.h"
+#include "search/material_difference_comparison.h"
+#include "search/principal_variation.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace Chess
+{
+
+/// @brief A legal move at the root together with what the last iteration learned about it.
+struct RootMove
+{
+    Bitmove move{kBitNullMove};
+
+    /// Negamax evaluation of the last iteration. Exact for the best move, an upper bound for all others.
+    Evaluation evaluation{-kInfinity};
+
+    /// Size of the subtree below this move in the last iteration.
+    std::size_t number_of_nodes{0};
+
+    /// Line starting with this move as of the last iteration. Only kept for the best move (or best moves in MultiPV).
+    std::vector<Bitmove> principal_variation{};
+};
+
+/// @brief Root moves persist over the iterations of one search (unlike the move stack of interior nodes).
+using RootMoves = std::vector<RootMove>;
+
+/// @brief Collects all legal moves of position, initially ordered like moves of interior nodes.
+template <typename GenerateBehavior>
+RootMoves GenerateRootMoves(Position& position, const MoveStack::iterator end_before_move_generation)
+{
+    const MoveStack::iterator end_after_move_generation =
+        GenerateMoves<GenerateBehavior>(position, ComputeCheckState(position), end_before_move_generation);
+    std::sort(end_before_move_generation, end_after_move_generation, IsMaterialDifferenceGreater);
+
+    RootMoves root_moves{};
+    for (auto move_iterator = end_before_move_generation; move_iterator != end_after_move_generation; move_iterator++)
+    {
+        root_moves.push_back({*move_iterator});
+    }
+    return root_moves;
+}
+
+/// @brief Orders root moves for the next iteration.
+///
+/// The best moves (of which there is more than one in MultiPV mode) are expected in front and are left in place. All
+/// others are ordered by decreasing subtree size, as a big subtree indicates a move that was hard to refute, i.e. a
+/// good candidate to become the best move.
+inline void SortRootMoves(RootMoves& root_moves, const std::size_t number_of_best_moves)
+{
+    const auto end_of_best_moves = begin(root_moves) + std::min(number_of_best_moves, root_moves.size());
+    std::stable_sort(end_of_best_moves, end(root_moves), [](const RootMove& a, const RootMove& b) {
+        return a.number_of_nodes > b.number_of_nodes;
+    });
+    std::for_each(end_of_best_moves, end(root_moves), [](RootMove& root_move) {
+        root_move.principal_variation.clear();
+    });
+}
+
+/// @brief Searches the root moves in [first, last) (in the given order) and updates evaluations and subtree sizes.
+///
+/// Apart from move ordering and bookkeeping this is the root node of FindBestMove. Moves outside of [first, last) are
+/// excluded from the search, which is used by MultiPV to exclude best moves found by previous passes. Afterwards the
+/// best move is moved to first.
+///
+/// Like at the root of FindBestMove, the first move is expected on the principal variation and all others to be cut.
+template <typename GenerateBehavior, typename EvaluateBehavior, typename DebugBehavior = DebuggingDisabled>
+Evaluation SearchRootMoves(Position& position,
+                           PrincipalVariation& principal_variation,
+                           HashHistory& hash_history,
+                           const RootMoves::iterator first,
+                           const RootMoves::iterator last,
+                           const MoveStack::iterator end_before_move_generation,
+                           const Evaluation negamax_sign,
+                           const AbortCondition& abort_condition,
+                           SearchStatistic& statistic)
+{
+    constexpr std::size_t root_depth{0};
+    statistic.number_of_nodes++;
+    ThrowIfCalculationIsDue(abort_condition, statistic.number_of_nodes);
+
+    if (first == last)
+    {
+        principal_variation.ClearLine(root_depth);
+        return DetermineGameResult(ComputeCheckState(position), root_depth);
+    }
+
+    Evaluation negamax_alpha = -kInfinity;
+    const Evaluation negamax_beta = kInfinity;
+    RootMoves::iterator best_root_move = first;
+    for (RootMoves::iterator root_move = first; root_move != last; root_move++)
+    {
+        const std::size_t number_of_nodes_before_move = statistic.number_of_nodes;
+        const Bitboard saved_extras = position.MakeMove(root_move->move);
+        hash_history.Push(root_move->move, saved_extras, position);
+        root_move->evaluation =
+            -FindBestMove<GenerateBehavior, EvaluateBehavior, DebugBehavior>(position,
+                                                                             principal_variation,
+                                                                             hash_history,
+                                                                             end_before_move_generation,
+                                                                             -negamax_sign,
+                                                                             abort_condition,
+                                                                             statistic,
+                                                                             root_depth + 1,
+                                                                             -negamax_beta,
+                                                                             -negamax_alpha,
+                                                                             root_move != first);
+        hash_history.Pop();
+        position.UnmakeMove(root_move->move, saved_extras);
+        root_move->number_of_nodes = statistic.number_of_nodes - number_of_nodes_before_move;
+
+        if (root_move->evaluation > negamax_alpha)
+        {
+            negamax_alpha = root_move->evaluation;
+            best_root_move = root_move;
+            principal_variation.PromoteSubline(root_depth, root_move->move);
+        }
+    }
+
+    std::rotate(first, best_root_move, std::next(best_root_move));
+    return negamax_alpha;
+}
+
+}  // namespace Chess
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SEARCH_SEARCH_SCHEDULER_H
+#define SEARCH_SEARCH_SCHEDULER_H
+
+#include "search/coroutine_search.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Chess
+{
+
+/// @brief Interleaves several searches on the calling thread (e.g. for several games hosted by one process).
+///
+/// Searches take turns round robin, each running for one time slice (see FindBestMoveCoroutine).
+class SearchScheduler
+{
+  public:
+    /// @returns Index to access the search later.
+    std::size_t Add(SearchTask&& task)
+    {
+        tasks_.push_back(std::move(task));
+        return tasks_.size() - 1;
+    }
+
+    /// @brief Gives every unfinished search one time slice.
+    ///
+    /// @returns Whether any search is left unfinished.
+    bool RunOneRound()
+    {
+        std::for_each(begin(tasks_), end(tasks_), [](SearchTask& task) { task.Resume(); });
+        return std::any_of(begin(tasks_), end(tasks_), [](const SearchTask& task) { return !task.IsDone(); });
+    }
+
+    void RunUntilAllDone()
+    {
+        while (RunOneRound())
+        {
+        }
+    }
+
+    const SearchTask& GetTask(const std::size_t index) const { return tasks_.at(index); }
+
+  private:
+    std::vector<SearchTask> tasks_{};
+};
+
+}  // namespace Chess
+
+#endif
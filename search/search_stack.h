@@ -0,0 +1,45 @@
+#ifndef SEARCH_SEARCH_STACK_H
+#define SEARCH_SEARCH_STACK_H
+
+#include "bitboard/basic_type_declarations.h"
+#include "bitboard/check_state.h"
+#include "bitboard/move.h"
+#include "bitboard/move_stack.h"
+#include "evaluate/evaluate.h"
+#include "search/principal_variation.h"
+
+#include <array>
+
+namespace Chess
+{
+
+/// @brief State of a single node of the search, i.e. what the recursive search keeps in its parameters and locals.
+///
+/// This is the place for further per-ply state (e.g. static evaluation or killer moves).
+struct SearchFrame
+{
+    MoveStack::iterator end_before_move_generation{};
+    MoveStack::iterator end_after_move_generation{};
+    MoveStack::iterator move_iterator{};
+    Bitmove current_move{kBitNullMove};
+    Bitboard saved_extras{0};
+    Evaluation negamax_sign{1};
+    Evaluation negamax_alpha{-kInfinity};
+    Evaluation negamax_beta{kInfinity};
+    Evaluation initial_negamax_alpha{-kInfinity};  // alpha every (reduced) search of the node starts with
+    bool is_terminal_node{true};
+    CheckState check_state{};
+
+    /// Plies searched below this node by its current search, which is reduced by internal iterative deepening until
+    /// no reduced searches are left.
+    std::size_t full_search_depth{0};
+    std::size_t number_of_reduced_searches_left{0};
+    Bitmove move_to_search_first{kBitNullMove};
+};
+
+/// @brief One frame per ply of the currently searched path. (One more than plies, as the leaf needs a frame, too.)
+using SearchStack = std::array<SearchFrame, kMaximumLengthOfPrincipalVariation + 1>;
+
+}  // namespace Chess
+
+#endif
@@ -0,0 +1,134 @@
+#include "search/coroutine_search.h"
+#include "search/search_scheduler.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "evaluate/evaluate.h"
+
+#include <gtest/gtest.h>
+
+namespace Chess
+{
+namespace
+{
+
+constexpr const char* const kMateInThree = "7r/Q1p2ppp/1p3k2/1Bb5/5q2/2N5/PPPrR1KP/R7 b - - 2 21";
+constexpr Evaluation kNegamaxSignForMateInThree{-1};
+constexpr const char* const kMiddleGame = "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10";
+constexpr Evaluation kNegamaxSignForMiddleGame{1};
+
+SearchResult SearchWithoutInterruption(const std::string& fen, const Evaluation negamax_sign, const std::size_t depth)
+{
+    Position position{PositionFromFen(fen)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    MoveStack move_stack{};
+    SearchResult result{};
+    result.evaluation =
+        FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled, ForwardPruningDisabled>(
+            position,
+            principal_variation,
+            hash_history,
+            move_stack.begin(),
+            negamax_sign,
+            AbortCondition{depth},
+            result.statistic);
+    result.principal_variation = principal_variation.GetMainLine();
+    return result;
+}
+
+TEST(FindBestMoveCoroutineTest, GivenTimeSlices_ExpectSameResultAsUninterruptedSearch)
+{
+    // Setup
+    constexpr std::size_t depth{6};
+    constexpr std::size_t nodes_per_time_slice{1000};
+    const SearchResult expected_result = SearchWithoutInterruption(kMateInThree, kNegamaxSignForMateInThree, depth);
+
+    // Call
+    const Position position{PositionFromFen(kMateInThree)};
+    SearchTask task = FindBestMoveCoroutine<GenerateAllPseudoLegalMoves, EvaluateMaterial>(
+        position, HashHistory{position}, kNegamaxSignForMateInThree, AbortCondition{depth}, nodes_per_time_slice);
+    std::size_t number_of_time_slices{0};
+    while (!task.IsDone())
+    {
+        SearchTask moved_task{std::move(task)};  // state is owned by the coroutine, not by the handle
+        moved_task.Resume();
+        task = std::move(moved_task);
+        number_of_time_slices++;
+    }
+
+    // Expect
+    const SearchResult& result = task.GetResult();
+    EXPECT_EQ(result.evaluation, expected_result.evaluation);
+    EXPECT_EQ(result.principal_variation, expected_result.principal_variation);
+    EXPECT_EQ(result.statistic.number_of_nodes, expected_result.statistic.number_of_nodes);
+    const std::size_t expected_number_of_time_slices =
+        (expected_result.statistic.number_of_nodes + nodes_per_time_slice - 1) / nodes_per_time_slice;
+    EXPECT_EQ(number_of_time_slices, expected_number_of_time_slices);
+}
+
+TEST(FindBestMoveCoroutineTest, GivenNodeLimit_ExpectDoneAndResultThrowsCalculationWasDue)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.full_search_depth = 8;
+    abort_condition.node_limit = 5000;
+    const Position position{PositionFromFen(kStandardStartingPosition)};
+    SearchTask task = FindBestMoveCoroutine<GenerateAllPseudoLegalMoves, EvaluateMaterial>(
+        position, HashHistory{position}, 1, abort_condition, 1000);
+
+    // Call
+    while (!task.IsDone())
+    {
+        task.Resume();
+    }
+
+    // Expect
+    EXPECT_THROW(std::ignore = task.GetResult(), CalculationWasDue);
+}
+
+TEST(SearchSchedulerTest, GivenTwoSearches_ExpectInterleavedAndSameResultsAsUninterruptedSearches)
+{
+    // Setup
+    constexpr std::size_t depth{4};
+    constexpr std::size_t nodes_per_time_slice{500};
+    const Position mate_in_three_position{PositionFromFen(kMateInThree)};
+    const Position middle_game_position{PositionFromFen(kMiddleGame)};
+    SearchScheduler scheduler{};
+    const std::size_t mate_in_three = scheduler.Add(
+        FindBestMoveCoroutine<GenerateAllPseudoLegalMoves, EvaluateMaterial>(mate_in_three_position,
+                                                                             HashHistory{mate_in_three_position},
+                                                                             kNegamaxSignForMateInThree,
+                                                                             AbortCondition{depth},
+                                                                             nodes_per_time_slice));
+    const std::size_t middle_game = scheduler.Add(
+        FindBestMoveCoroutine<GenerateAllPseudoLegalMoves, EvaluateMaterial>(middle_game_position,
+                                                                             HashHistory{middle_game_position},
+                                                                             kNegamaxSignForMiddleGame,
+                                                                             AbortCondition{depth},
+                                                                             nodes_per_time_slice));
+
+    // Call
+    const bool is_unfinished_after_first_round = scheduler.RunOneRound();
+    const bool is_mate_in_three_done_after_first_round = scheduler.GetTask(mate_in_three).IsDone();
+    const bool is_middle_game_done_after_first_round = scheduler.GetTask(middle_game).IsDone();
+    scheduler.RunUntilAllDone();
+
+    // Expect
+    EXPECT_TRUE(is_unfinished_after_first_round);
+    EXPECT_FALSE(is_mate_in_three_done_after_first_round);
+    EXPECT_FALSE(is_middle_game_done_after_first_round);
+    const SearchResult expected_mate_in_three =
+        SearchWithoutInterruption(kMateInThree, kNegamaxSignForMateInThree, depth);
+    const SearchResult expected_middle_game = SearchWithoutInterruption(kMiddleGame, kNegamaxSignForMiddleGame, depth);
+    EXPECT_EQ(scheduler.GetTask(mate_in_three).GetResult().principal_variation,
+              expected_mate_in_three.principal_variation);
+    EXPECT_EQ(scheduler.GetTask(mate_in_three).GetResult().statistic.number_of_nodes,
+              expected_mate_in_three.statistic.number_of_nodes);
+    EXPECT_EQ(scheduler.GetTask(middle_game).GetResult().principal_variation, expected_middle_game.principal_variation);
+    EXPECT_EQ(scheduler.GetTask(middle_game).GetResult().statistic.number_of_nodes,
+              expected_middle_game.statistic.number_of_nodes);
+}
+
+}  // namespace
+}  // namespace Chess
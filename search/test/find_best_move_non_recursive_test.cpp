@@ -0,0 +1,150 @@
+#include "search/find_best_move_non_recursive.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "evaluate/evaluate.h"
+
+#include <gtest/gtest.h>
+
+namespace Chess
+{
+namespace
+{
+
+class FindBestMoveNonRecursiveEquivalence : public testing::TestWithParam<std::tuple<std::string, std::size_t>>
+{
+  public:
+    std::string GetFen() { return std::get<0>(GetParam()); }
+    std::size_t GetFullSearchDepth() { return std::get<1>(GetParam()); }
+    Evaluation GetNegaMaxSign()
+    {
+        const auto side = TokenizeFen(GetFen()).at(kFenTokenSide);
+        return side == "w" ? Evaluation{1} : Evaluation{-1};
+    }
+
+    template <typename DeepeningBehavior>
+    void ExpectSameResultAndNodesAsRecursiveSearch()
+    {
+        // Setup
+        const AbortCondition abort_condition{GetFullSearchDepth()};
+        MoveStack move_stack{};
+        SearchStack search_stack{};
+        Position recursive_position{PositionFromFen(GetFen())};
+        HashHistory recursive_hash_history{recursive_position};
+        PrincipalVariation recursive_principal_variation{};
+        SearchStatistic recursive_statistic{};
+        Position non_recursive_position{PositionFromFen(GetFen())};
+        HashHistory non_recursive_hash_history{non_recursive_position};
+        PrincipalVariation non_recursive_principal_variation{};
+        SearchStatistic non_recursive_statistic{};
+
+        // Call
+        const auto recursive_evaluation =
+            FindBestMove<GenerateAllPseudoLegalMoves,
+                         EvaluateMaterial,
+                         DebuggingDisabled,
+                         ForwardPruningDisabled,
+                         MakeAndUnmakeMoves,
+                         DeepeningBehavior>(
+                recursive_position,
+                recursive_principal_variation,
+                recursive_hash_history,
+                move_stack.begin(),
+                GetNegaMaxSign(),
+                abort_condition,
+                recursive_statistic);
+        const auto non_recursive_evaluation =
+            FindBestMoveNonRecursive<GenerateAllPseudoLegalMoves, EvaluateMaterial, DeepeningBehavior>(
+                non_recursive_position,
+                non_recursive_principal_variation,
+                non_recursive_hash_history,
+                search_stack,
+                move_stack.begin(),
+                GetNegaMaxSign(),
+                abort_condition,
+                non_recursive_statistic);
+
+        // Expect
+        EXPECT_EQ(non_recursive_evaluation, recursive_evaluation);
+        EXPECT_EQ(non_recursive_principal_variation.GetMainLine(), recursive_principal_variation.GetMainLine());
+        EXPECT_EQ(non_recursive_statistic.number_of_nodes, recursive_statistic.number_of_nodes);
+        EXPECT_EQ(FenFromPosition(non_recursive_position), GetFen());
+    }
+};
+
+TEST_P(FindBestMoveNonRecursiveEquivalence, GivenPosition_ExpectSameResultAndNodesAsRecursiveSearch)
+{
+    ExpectSameResultAndNodesAsRecursiveSearch<InternalIterativeDeepeningDisabled>();
+}
+
+TEST_P(FindBestMoveNonRecursiveEquivalence, GivenInternalIterativeDeepening_ExpectSameResultAndNodesAsRecursiveSearch)
+{
+    ExpectSameResultAndNodesAsRecursiveSearch<InternalIterativeDeepeningEnabled>();
+}
+
+const std::array<std::tuple<std::string, std::size_t>, 8> kEquivalencePositions{{
+    {kStandardStartingPosition, 0},
+    {kStandardStartingPosition, 1},
+    {kStandardStartingPosition, 4},
+    {"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 4},
+    {"8/2p5/1P1p4/2P3rk/KR3p2/4P1p1/5P2/8 w - - 0 1", 7},  // internal iterative deepening
+    {"7r/Q1p2ppp/1p3k2/1Bb5/5q2/2N5/PPPrR1KP/R7 b - - 2 21", 6},  // checkmate in three
+    {"8/8/8/8/8/2K1Q3/8/3k4 b - - 0 1", 3},                       // stalemate
+    {"5r1k/4b1p1/p6R/1p6/1P1p1QP1/P2P4/B1r2RK1/3q4 b - - 0 36", 4},  // checkmated in three plies
+}};
+
+INSTANTIATE_TEST_SUITE_P(VariousPositions,
+                         FindBestMoveNonRecursiveEquivalence,
+                         testing::ValuesIn(kEquivalencePositions));
+
+TEST(FindBestMoveNonRecursiveTest, GivenSearchDepthBeyondSearchStack_ExpectThrowsOutOfRange)
+{
+    // Setup
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStack search_stack{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    const AbortCondition abort_condition{search_stack.size()};
+
+    // Call & Expect
+    EXPECT_THROW((FindBestMoveNonRecursive<GenerateAllPseudoLegalMoves, EvaluateMaterial>(position,
+                                                                                          principal_variation,
+                                                                                          hash_history,
+                                                                                          search_stack,
+                                                                                          move_stack.begin(),
+                                                                                          1,
+                                                                                          abort_condition,
+                                                                                          statistic)),
+                 std::out_of_range);
+}
+
+TEST(FindBestMoveNonRecursiveTest, GivenNodeLimit_ExpectThrowsCalculationIsDueOnFirstNodeBeyondLimit)
+{
+    // Setup
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStack search_stack{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    AbortCondition abort_condition{};
+    abort_condition.full_search_depth = 8;
+    abort_condition.node_limit = 12345;
+
+    // Call & Expect
+    EXPECT_THROW((FindBestMoveNonRecursive<GenerateAllPseudoLegalMoves, EvaluateMaterial>(position,
+                                                                                          principal_variation,
+                                                                                          hash_history,
+                                                                                          search_stack,
+                                                                                          move_stack.begin(),
+                                                                                          1,
+                                                                                          abort_condition,
+                                                                                          statistic)),
+                 CalculationWasDue);
+    EXPECT_EQ(statistic.number_of_nodes, abort_condition.node_limit + 1);
+}
+
+}  // namespace
+}  // namespace Chess
@@ -22,7 +22,8 @@ Position EncodeUniqueIdToZero()
     position[kBlackBoard + kPawn] = H1;
     position[kWhiteBoard + kKing] = A8;
     position[kBlackBoard + kKing] = A8;
-    position.white_to_move_ = true;
+    position.SetWhiteToMove(true);
+    position.UpdateOccupiedSquares();
     return position;
 }
 
@@ -59,11 +60,12 @@ struct GenerateTwoMovesThatEncodeUniqueId
 template <typename Behavior>
 std::enable_if_t<Behavior::generate_two_moves_that_encode_unique_id, MoveStack::iterator> GenerateMoves(
     const Position& position,
+    const CheckState& /*unused*/,
     MoveStack::iterator move_generation_insertion_iterator)
 {
     static int unique_id{0};
 
-    const std::size_t side = position.white_to_move_ ? kWhiteBoard : kBlackBoard;
+    const std::size_t side = position.IsWhiteToMove() ? kWhiteBoard : kBlackBoard;
     for (int i = 1; i < 3; i++)
     {
         *move_generation_insertion_iterator++ = ComposeMove(
@@ -119,6 +121,23 @@ struct CountEvaluations
 };
 long CountEvaluations::number_of_evaluations{};
 
+struct RecordPliesOfFirstEvaluation
+{
+    static constexpr bool record_plies_of_first_evaluation{true};
+    static std::size_t total_plies;
+};
+std::size_t RecordPliesOfFirstEvaluation::total_plies{};
+
+template <typename Behaviour>
+std::enable_if_t<Behaviour::record_plies_of_first_evaluation, Evaluation> Evaluate(const Position& position)
+{
+    if (RecordPliesOfFirstEvaluation::total_plies == 0)
+    {
+        RecordPliesOfFirstEvaluation::total_plies = position.GetTotalPlies();
+    }
+    return 0;
+}
+
 template <typename Behaviour>
 std::enable_if_t<Behaviour::count_evaluations, Evaluation> Evaluate(const Position& position)
 {
@@ -137,7 +156,9 @@ TEST(FindBestMovePruningTest, GivenDepth3_ExpectEvaluationOrderFromExample)
     constexpr Chess::AbortCondition abort_condition{full_search_depth};
     MoveStack move_stack{};
     PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
     Position position{EncodeUniqueIdToZero()};
+    HashHistory hash_history{position};
     const Evaluation negamax_sign_for_white{1};
     EvaluteAccordingToEncodedUniqueId::unique_id_evaluation_order = {};
     EvaluteAccordingToEncodedUniqueId::unique_id_evaluation = {};
@@ -151,7 +172,13 @@ TEST(FindBestMovePruningTest, GivenDepth3_ExpectEvaluationOrderFromExample)
 
     // Call
     FindBestMove<GenerateTwoMovesThatEncodeUniqueId, EvaluteAccordingToEncodedUniqueId, DebuggingDisabled>(
-        position, principal_variation, move_stack.begin(), negamax_sign_for_white, abort_condition);
+        position,
+        principal_variation,
+        hash_history,
+        move_stack.begin(),
+        negamax_sign_for_white,
+        abort_condition,
+        statistic);
 
     // Expect
     std::cout << "Order of evaluation:" << std::endl;
@@ -184,17 +211,19 @@ TEST_P(FindBestMoveWhenForcedCheckmatePossible, GivenCheckmateIn3_ExpectCorrectC
     constexpr std::size_t full_search_depth = 6;
     constexpr Chess::AbortCondition abort_condition{full_search_depth};
     Position position{PositionFromFen(GetFen())};
+    HashHistory hash_history{position};
     MoveStack move_stack{};
     PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
 
     // Call
     FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
-        position, principal_variation, move_stack.begin(), GetNegaMaxSign(), abort_condition);
+        position, principal_variation, hash_history, move_stack.begin(), GetNegaMaxSign(), abort_condition, statistic);
 
     // Expect
     for (std::size_t index{0}; index < kPliesForCheckmateInThree; index++)
     {
-        EXPECT_EQ(ToUciString(principal_variation.at(index)), GetWinningLine().at(index))
+        EXPECT_EQ(ToUciString(principal_variation.GetMove(index)), GetWinningLine().at(index))
             << "lines differ at index: " << index;
     }
 }
@@ -229,32 +258,125 @@ TEST_P(FindBestMoveDetermineGameResult, GivenDecidedPosition_ExpectCorrectEvalua
     constexpr std::size_t full_search_depth = 6;
     constexpr Chess::AbortCondition abort_condition{full_search_depth};
     Position position{PositionFromFen(GetFen())};
+    HashHistory hash_history{position};
     MoveStack move_stack{};
     PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
 
     // Call
     const auto evaluation = FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
-        position, principal_variation, move_stack.begin(), GetNegaMaxSign(), abort_condition);
+        position, principal_variation, hash_history, move_stack.begin(), GetNegaMaxSign(), abort_condition, statistic);
 
     // Expect
-    EXPECT_FLOAT_EQ(evaluation, GetExpectedEvaluation());
+    EXPECT_EQ(evaluation, GetExpectedEvaluation());
 }
 
 const std::array<std::tuple<std::string, Evaluation>, 10> kFinalPositions{{
-    {"8/8/8/8/8/2K1Q3/8/3k4 b - - 0 1", Evaluation{0.0}},                              // stalemate on blacks turn
-    {"8/8/8/8/8/2k1q3/8/3K4 w - - 0 1", Evaluation{0.0}},                              // stalemate on whites turn
-    {"8/8/8/8/8/2k5/3q4/3K4 w - - 0 1", Evaluation{-1000.0}},                          // white checkmate
-    {"8/8/8/8/8/2K5/3Q4/3k4 b - - 0 1", Evaluation{-1000.0}},                          // black checkmate
-    {"6rk/5prp/1p3Q2/4N3/1P4b1/P3q1P1/7P/R1R2K2 b - - 1 30", Evaluation{999.0}},       // white checkmate in one ply
-    {"5b1r/R2R1p2/1pk1p2p/8/2P5/1PnK2P1/7P/8 w - - 3 33", Evaluation{999.0}},          // black checkmate in one ply
-    {"r6k/pp3Bpp/2p2B2/8/4N2Q/P4PP1/2P3K1/1R1r1q2 w - - 1 27", Evaluation{-998.0}},    // white checkmate in three plies
-    {"5r1k/4b1p1/p6R/1p6/1P1p1QP1/P2P4/B1r2RK1/3q4 b - - 0 36", Evaluation{-998.0}},   // black checkmate in three plies
-    {"r6k/pp3Bpp/2p2B2/1q6/4N2Q/P4PP1/2P3K1/1R1r4 b - - 0 26", Evaluation{997.0}},     // white checkmate in three plies
-    {"5r1k/4b1p1/p3R2p/1p6/1P1p1QP1/P2P4/B1r2RK1/3q4 w - - 1 36", Evaluation{997.0}},  // black checkmate in three plies
+    {"8/8/8/8/8/2K1Q3/8/3k4 b - - 0 1", Evaluation{0}},                        // stalemate on blacks turn
+    {"8/8/8/8/8/2k1q3/8/3K4 w - - 0 1", Evaluation{0}},                        // stalemate on whites turn
+    {"8/8/8/8/8/2k5/3q4/3K4 w - - 0 1", MatedIn(0)},                           // white checkmate
+    {"8/8/8/8/8/2K5/3Q4/3k4 b - - 0 1", MatedIn(0)},                           // black checkmate
+    {"6rk/5prp/1p3Q2/4N3/1P4b1/P3q1P1/7P/R1R2K2 b - - 1 30", MateIn(1)},       // white checkmate in one ply
+    {"5b1r/R2R1p2/1pk1p2p/8/2P5/1PnK2P1/7P/8 w - - 3 33", MateIn(1)},          // black checkmate in one ply
+    {"r6k/pp3Bpp/2p2B2/8/4N2Q/P4PP1/2P3K1/1R1r1q2 w - - 1 27", MatedIn(2)},    // white checkmate in three plies
+    {"5r1k/4b1p1/p6R/1p6/1P1p1QP1/P2P4/B1r2RK1/3q4 b - - 0 36", MatedIn(2)},   // black checkmate in three plies
+    {"r6k/pp3Bpp/2p2B2/1q6/4N2Q/P4PP1/2P3K1/1R1r4 b - - 0 26", MateIn(3)},     // white checkmate in three plies
+    {"5r1k/4b1p1/p3R2p/1p6/1P1p1QP1/P2P4/B1r2RK1/3q4 w - - 1 36", MateIn(3)},  // black checkmate in three plies
 }};
 
 INSTANTIATE_TEST_SUITE_P(VariousFinalPositions, FindBestMoveDetermineGameResult, testing::ValuesIn(kFinalPositions));
 
+TEST(FindBestMoveRepetitionTest, GivenPerpetualCheck_ExpectDrawDespiteMaterialDeficit)
+{
+    // Setup
+    constexpr std::size_t full_search_depth = 4;  // Qf6+ Kg8 Qg5+ Kh8 repeats the position
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+    Position position{PositionFromFen("5r1k/5p1p/8/6Q1/1q6/8/6PP/7K w - - 0 1")};
+    HashHistory hash_history{position};
+    MoveStack move_stack{};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    const ZobristKey key_before_search = hash_history.GetCurrentKey();
+
+    // Call
+    const auto evaluation = FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
+        position, principal_variation, hash_history, move_stack.begin(), 1, abort_condition, statistic);
+
+    // Expect
+    EXPECT_EQ(evaluation, kDraw);
+    EXPECT_EQ(ToUciString(principal_variation.GetMove(0)), "g5f6");
+    EXPECT_EQ(hash_history.GetCurrentKey(), key_before_search);
+}
+
+TEST(FindBestMoveDrawByRuleTest, GivenFiftyMoveRuleAboutToApply_ExpectDrawDespiteMaterialAdvantage)
+{
+    // Setup
+    constexpr std::size_t full_search_depth = 3;  // no mate within reach before the fifty moves are complete
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+    Position position{PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 99 80")};
+    HashHistory hash_history{position};
+    MoveStack move_stack{};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+
+    // Call
+    const auto evaluation = FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
+        position, principal_variation, hash_history, move_stack.begin(), 1, abort_condition, statistic);
+
+    // Expect
+    EXPECT_EQ(evaluation, kDraw);
+}
+
+TEST(FindBestMoveDrawByRuleTest, GivenCaptureLeavingInsufficientMaterial_ExpectDrawAndSubtreeNotExpanded)
+{
+    // Setup
+    constexpr std::size_t full_search_depth = 3;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+    Position position{PositionFromFen("8/8/8/8/8/4k3/4P3/B6K b - - 0 1")};
+    HashHistory hash_history{position};
+    MoveStack move_stack{};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+
+    // Call
+    const auto evaluation = FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
+        position, principal_variation, hash_history, move_stack.begin(), -1, abort_condition, statistic);
+
+    // Expect
+    EXPECT_EQ(evaluation, kDraw);
+    EXPECT_EQ(ToUciString(principal_variation.GetMove(0)), "e3e2");
+    EXPECT_EQ(principal_variation.GetLine(0).length, 1);  // ends with the capture, as nothing follows a dead position
+}
+
+TEST(FindBestMoveMateDistancePruningTest, GivenShorterMateAlreadyFound_ExpectNodeNotSearched)
+{
+    // Setup
+    constexpr std::size_t current_depth{3};
+    constexpr Chess::AbortCondition abort_condition{6};
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
+    MoveStack move_stack{};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    const Evaluation negamax_alpha = MateIn(2);  // no mate from within this node can be as short
+
+    // Call
+    const auto evaluation =
+        FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(position,
+                                                                                       principal_variation,
+                                                                                       hash_history,
+                                                                                       move_stack.begin(),
+                                                                                       1,
+                                                                                       abort_condition,
+                                                                                       statistic,
+                                                                                       current_depth,
+                                                                                       negamax_alpha);
+
+    // Expect
+    EXPECT_EQ(evaluation, negamax_alpha);
+    EXPECT_EQ(statistic.number_of_nodes, 1);
+}
+
 class FindBestMoveInvestigatesPrincipalVariationFirst : public testing::TestWithParam<std::array<Bitmove, 2>>
 {
   public:
@@ -280,13 +402,14 @@ TEST_P(FindBestMoveInvestigatesPrincipalVariationFirst,
     constexpr Chess::AbortCondition abort_condition{full_search_depth};
     constexpr Evaluation negamax_sign_for_starting_position{1};
     Position position{PositionFromFen(kSimpleArbitraryPosition)};
+    HashHistory hash_history{position};
     MoveStack move_stack{};
     PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
     const auto expected_principal_variation{GetPrincipalVariation()};
 
-    std::copy(std::begin(expected_principal_variation),  // provide input for search
-              std::end(expected_principal_variation),
-              std::begin(principal_variation));
+    principal_variation.SetMainLine(  // provide input for search
+        {std::begin(expected_principal_variation), std::end(expected_principal_variation)});
 
     std::copy(std::begin(expected_principal_variation),  // set expectation in static spy class
               std::end(expected_principal_variation),
@@ -296,7 +419,13 @@ TEST_P(FindBestMoveInvestigatesPrincipalVariationFirst,
     // Call
     std::ignore =
         FindBestMove<GenerateAllPseudoLegalMoves, CheckIfPrincipalVariationGetsEvaluatedFirst, DebuggingDisabled>(
-            position, principal_variation, move_stack.begin(), negamax_sign_for_starting_position, abort_condition);
+            position,
+            principal_variation,
+            hash_history,
+            move_stack.begin(),
+            negamax_sign_for_starting_position,
+            abort_condition,
+            statistic);
 
     // Expect
     EXPECT_TRUE(CheckIfPrincipalVariationGetsEvaluatedFirst::principal_variation_was_evaluated_fist);
@@ -318,7 +447,9 @@ TEST(PrincipalVariationSmokeTest, GivenCheckmateInThree_ExpectPrincipalVariation
     // Setup
     constexpr const char* const mate_in_three = "7r/Q1p2ppp/1p3k2/1Bb5/5q2/2N5/PPPrR1KP/R7 b - - 2 21";
     Position position{PositionFromFen(mate_in_three)};
+    HashHistory hash_history{position};
     PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
     MoveStack move_stack{};
     constexpr Evaluation negamax_sign{-1};
     constexpr std::size_t full_search_depth = 6;
@@ -327,25 +458,137 @@ TEST(PrincipalVariationSmokeTest, GivenCheckmateInThree_ExpectPrincipalVariation
     // Call
     CountEvaluations::number_of_evaluations = 0;
     std::ignore = FindBestMove<GenerateAllPseudoLegalMoves, CountEvaluations, DebuggingDisabled>(
-        position, principal_variation, move_stack.begin(), negamax_sign, abort_condition);
+        position, principal_variation, hash_history, move_stack.begin(), negamax_sign, abort_condition, statistic);
     const auto number_of_evaluations_without_principal_variation = CountEvaluations::number_of_evaluations;
 
-    ClearSublines(principal_variation);
+    principal_variation.ClearSublines();
 
     CountEvaluations::number_of_evaluations = 0;
     std::ignore = FindBestMove<GenerateAllPseudoLegalMoves, CountEvaluations, DebuggingDisabled>(
-        position, principal_variation, move_stack.begin(), negamax_sign, abort_condition);
+        position, principal_variation, hash_history, move_stack.begin(), negamax_sign, abort_condition, statistic);
     const auto number_of_evaluations_with_principal_variation = CountEvaluations::number_of_evaluations;
 
     // Expect
     EXPECT_LT(number_of_evaluations_with_principal_variation, number_of_evaluations_without_principal_variation);
 }
 
+template <typename PruneBehavior, typename MakeBehavior = MakeAndUnmakeMoves>
+std::tuple<Evaluation, Bitmove, std::size_t> SearchWithBehaviors(const std::string& fen,
+                                                               const std::size_t full_search_depth)
+{
+    Position position{PositionFromFen(fen)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    const Evaluation evaluation =
+        FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled, PruneBehavior, MakeBehavior>(
+            position,
+            principal_variation,
+            hash_history,
+            move_stack.begin(),
+            1,
+            AbortCondition{full_search_depth},
+            statistic);
+    EXPECT_EQ(FenFromPosition(position), FenFromPosition(PositionFromFen(fen)));
+    return {evaluation, principal_variation.GetMove(0), statistic.number_of_nodes};
+}
+
+TEST(FindBestMoveForwardPruningTest, GivenTacticalPosition_ExpectSameResultWithFewerNodes)
+{
+    constexpr const char* const kiwipete = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+    constexpr std::size_t full_search_depth{6};
+
+    const auto [evaluation, best_move, number_of_nodes] =
+        SearchWithBehaviors<ForwardPruningEnabled>(kiwipete, full_search_depth);
+    const auto [evaluation_without_pruning, best_move_without_pruning, number_of_nodes_without_pruning] =
+        SearchWithBehaviors<ForwardPruningDisabled>(kiwipete, full_search_depth);
+
+    EXPECT_EQ(evaluation, evaluation_without_pruning);
+    EXPECT_EQ(ToUciString(best_move), ToUciString(best_move_without_pruning));
+    EXPECT_LT(number_of_nodes, number_of_nodes_without_pruning);
+}
+
+TEST(FindBestMoveForwardPruningTest, GivenMultiCutOnTopOfProbCut_ExpectSameResult)
+{
+    constexpr const char* const kiwipete = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+    constexpr std::size_t full_search_depth{6};
+
+    const auto [evaluation, best_move, number_of_nodes] =
+        SearchWithBehaviors<ForwardPruningWithMultiCut>(kiwipete, full_search_depth);
+    const auto [evaluation_without_multi_cut, best_move_without_multi_cut, number_of_nodes_without_multi_cut] =
+        SearchWithBehaviors<ForwardPruningEnabled>(kiwipete, full_search_depth);
+    std::ignore = number_of_nodes;
+    std::ignore = number_of_nodes_without_multi_cut;  // Multi-cut does not save nodes here.
+
+    EXPECT_EQ(evaluation, evaluation_without_multi_cut);
+    EXPECT_EQ(ToUciString(best_move), ToUciString(best_move_without_multi_cut));
+}
+
+TEST(FindBestMoveCopyMakeTest, GivenTacticalPosition_ExpectSameSearchAsMakeUnmake)
+{
+    constexpr const char* const kiwipete = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+    constexpr std::size_t full_search_depth{5};
+
+    const auto [evaluation, best_move, number_of_nodes] =
+        SearchWithBehaviors<ForwardPruningEnabled, MakeAndUnmakeMoves>(kiwipete, full_search_depth);
+    const auto [evaluation_copy_make, best_move_copy_make, number_of_nodes_copy_make] =
+        SearchWithBehaviors<ForwardPruningEnabled, CopyAndMakeMoves>(kiwipete, full_search_depth);
+
+    EXPECT_EQ(evaluation, evaluation_copy_make);
+    EXPECT_EQ(ToUciString(best_move), ToUciString(best_move_copy_make));
+    EXPECT_EQ(number_of_nodes, number_of_nodes_copy_make);
+}
+
+/// Searches the starting position as if searched before, so that no move is suggested by the principal variation.
+/// @returns The total plies of the first evaluated position.
+template <typename DeepeningBehavior>
+std::size_t SearchWithoutSuggestedMove(const std::size_t full_search_depth)
+{
+    const Chess::AbortCondition abort_condition{full_search_depth};
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    principal_variation.PromoteSubline(  // lines of both plies exist, as if searched before, so none is suggested
+        1,
+        ComposeMove(tzcnt(E7), tzcnt(E5), kPawn, kNoCapture, kNoPromotion, kMoveTypePawnDoublePush));
+    principal_variation.PromoteSubline(
+        0,
+        ComposeMove(tzcnt(E2), tzcnt(E4), kPawn, kNoCapture, kNoPromotion, kMoveTypePawnDoublePush));
+
+    RecordPliesOfFirstEvaluation::total_plies = 0;
+    std::ignore = FindBestMove<GenerateAllPseudoLegalMoves,
+                               RecordPliesOfFirstEvaluation,
+                               DebuggingDisabled,
+                               ForwardPruningEnabled,
+                               MakeAndUnmakeMoves,
+                               DeepeningBehavior>(
+        position, principal_variation, hash_history, move_stack.begin(), 1, abort_condition, statistic);
+    return RecordPliesOfFirstEvaluation::total_plies - position.GetTotalPlies();
+}
+
+TEST(FindBestMoveInternalIterativeDeepeningTest, GivenNoMoveSuggestedByPrincipalVariation_ExpectReducedSearchFirst)
+{
+    constexpr std::size_t full_search_depth = kInternalIterativeDeepeningMinimumDepth;
+    EXPECT_EQ(SearchWithoutSuggestedMove<InternalIterativeDeepeningEnabled>(full_search_depth),
+              full_search_depth - kInternalIterativeDeepeningReduction);
+}
+
+TEST(FindBestMoveInternalIterativeDeepeningTest, GivenDisabled_ExpectFullSearchFirst)
+{
+    constexpr std::size_t full_search_depth = kInternalIterativeDeepeningMinimumDepth;
+    EXPECT_EQ(SearchWithoutSuggestedMove<InternalIterativeDeepeningDisabled>(full_search_depth), full_search_depth);
+}
+
 TEST(FindBestMoveTest, GivenTimeForCalculationIsOver_ExpectThrowsCalculationIsDue)
 {
     // Setup
     Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
     PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
     MoveStack move_stack{};
     constexpr Evaluation negamax_sign_for_starting_position{1};
     constexpr std::size_t full_search_depth = 8;
@@ -355,8 +598,41 @@ TEST(FindBestMoveTest, GivenTimeForCalculationIsOver_ExpectThrowsCalculationIsDu
     // Call& Expect
     EXPECT_THROW(
         (FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
-            position, principal_variation, move_stack.begin(), negamax_sign_for_starting_position, abort_condition)),
+            position,
+            principal_variation,
+            hash_history,
+            move_stack.begin(),
+            negamax_sign_for_starting_position,
+            abort_condition,
+            statistic)),
+        CalculationWasDue);
+}
+
+TEST(FindBestMoveTest, GivenNodeLimit_ExpectThrowsCalculationIsDueOnFirstNodeBeyondLimit)
+{
+    // Setup
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    constexpr Evaluation negamax_sign_for_starting_position{1};
+    Chess::AbortCondition abort_condition{};
+    abort_condition.full_search_depth = 8;
+    abort_condition.node_limit = 12345;
+
+    // Call & Expect
+    EXPECT_THROW(
+        (FindBestMove<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingDisabled>(
+            position,
+            principal_variation,
+            hash_history,
+            move_stack.begin(),
+            negamax_sign_for_starting_position,
+            abort_condition,
+            statistic)),
         CalculationWasDue);
+    EXPECT_EQ(statistic.number_of_nodes, abort_condition.node_limit + 1);
 }
 
 }  // namespace
@@ -0,0 +1,78 @@
+#include "search/hash_history.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/move_stack.h"
+#include "bitboard/uci_conversion.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace
+{
+
+class HashHistoryTestFixture : public testing::Test
+{
+  public:
+    void Play(const std::vector<std::string>& uci_moves)
+    {
+        for (const std::string& uci_move : uci_moves)
+        {
+            const auto end = GenerateMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+            const auto move = std::find_if(
+                move_stack.begin(), end, [&uci_move](const auto move) { return ToUciString(move) == uci_move; });
+            if (move == end)
+            {
+                throw std::runtime_error{"Move not possible: " + uci_move};
+            }
+            const Bitboard extras_before_move = position.MakeMove(*move);
+            hash_history.Push(*move, extras_before_move, position);
+        }
+    }
+
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    HashHistory hash_history{position};
+    MoveStack move_stack{};
+};
+
+TEST_F(HashHistoryTestFixture, GivenKnightsMovedBackAndForth_ExpectRepetition)
+{
+    Play({"g1f3", "g8f6", "f3g1"});
+    EXPECT_FALSE(hash_history.IsRepetition(position.GetStaticPlies()));
+
+    Play({"f6g8"});
+    EXPECT_TRUE(hash_history.IsRepetition(position.GetStaticPlies()));
+    EXPECT_EQ(hash_history.GetCurrentKey(), ComputeZobristKey(PositionFromFen(kStandardStartingPosition)));
+}
+
+TEST_F(HashHistoryTestFixture, GivenRepetitionUndone_ExpectNoRepetition)
+{
+    Play({"g1f3", "g8f6", "f3g1", "f6g8"});
+
+    hash_history.Pop();
+
+    EXPECT_FALSE(hash_history.IsRepetition(4));
+}
+
+TEST_F(HashHistoryTestFixture, GivenRepetitionBeyondReversiblePlies_ExpectNotScanned)
+{
+    Play({"g1f3", "g8f6", "f3g1", "f6g8"});
+
+    EXPECT_FALSE(hash_history.IsRepetition(3));
+}
+
+TEST(HashHistoryTest, GivenFewerKeysThanReversiblePlies_ExpectNoRepetition)
+{
+    const HashHistory hash_history{PositionFromFen("4k3/8/8/8/8/8/8/4K3 w - - 40 80")};
+
+    EXPECT_FALSE(hash_history.IsRepetition(40));
+}
+
+}  // namespace
+}  // namespace Chess
@@ -0,0 +1,215 @@
+#include "search/iterative_deepening.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "evaluate/evaluate.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+namespace Chess
+{
+namespace
+{
+
+constexpr const char* const kMateInThree = "7r/Q1p2ppp/1p3k2/1Bb5/5q2/2N5/PPPrR1KP/R7 b - - 2 21";
+constexpr Evaluation kNegamaxSignForMateInThree{-1};
+
+class IterativeDeepeningTestFixture : public testing::Test
+{
+  public:
+    std::vector<IterationResult> Search(const AbortCondition& abort_condition, const std::size_t number_of_lines = 1)
+    {
+        principal_variation.Clear();
+        root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+        statistic = {};
+        return IterativeDeepening<GenerateAllPseudoLegalMoves, EvaluateMaterial>(position,
+                                                                                 principal_variation,
+                                                                                 hash_history,
+                                                                                 root_moves,
+                                                                                 move_stack.begin(),
+                                                                                 kNegamaxSignForMateInThree,
+                                                                                 abort_condition,
+                                                                                 statistic,
+                                                                                 number_of_lines);
+    }
+
+    Position position{PositionFromFen(kMateInThree)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    RootMoves root_moves{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+};
+
+TEST_F(IterativeDeepeningTestFixture, GivenDepthLimit_ExpectOneResultPerDepthStartingAtOne)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.maximum_search_depth = 4;
+
+    // Call
+    const auto iterations = Search(abort_condition);
+
+    // Expect
+    ASSERT_EQ(iterations.size(), 4);
+    for (std::size_t index{0}; index < iterations.size(); index++)
+    {
+        EXPECT_EQ(iterations[index].depth, index + 1);
+        EXPECT_NE(iterations[index].best_move, kBitNullMove);
+    }
+    const auto sum_of_nodes = std::accumulate(
+        begin(iterations), end(iterations), std::size_t{0}, [](const auto sum, const auto& iteration) {
+            return sum + iteration.number_of_nodes;
+        });
+    EXPECT_EQ(sum_of_nodes, statistic.number_of_nodes);
+}
+
+TEST_F(IterativeDeepeningTestFixture, GivenMateInThree_ExpectFoundOnceDeepEnough)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.maximum_search_depth = 6;
+
+    // Call
+    const auto iterations = Search(abort_condition);
+
+    // Expect
+    ASSERT_EQ(iterations.size(), 6);
+    EXPECT_EQ(ToUciString(iterations.back().best_move), "f4g4");
+    EXPECT_EQ(iterations.back().evaluation, MateIn(5));
+    EXPECT_EQ(FenFromPosition(position), kMateInThree);
+}
+
+TEST_F(IterativeDeepeningTestFixture, GivenIterationInterrupted_ExpectPrincipalVariationOfLastCompletedIteration)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.maximum_search_depth = 5;
+    const auto iterations_up_to_depth_5 = Search(abort_condition);
+    const std::vector<Bitmove> principal_variation_at_depth_5 = principal_variation.GetMainLine();
+    const std::size_t nodes_up_to_depth_5 = statistic.number_of_nodes;
+
+    abort_condition.maximum_search_depth = 6;
+    abort_condition.node_limit = nodes_up_to_depth_5 + 1000;  // interrupts iteration 6
+
+    // Call
+    const auto iterations = Search(abort_condition);
+
+    // Expect
+    ASSERT_EQ(iterations.size(), 5);
+    EXPECT_EQ(iterations.back().best_move, iterations_up_to_depth_5.back().best_move);
+    EXPECT_EQ(iterations.back().evaluation, iterations_up_to_depth_5.back().evaluation);
+    EXPECT_EQ(principal_variation.GetMainLine(), principal_variation_at_depth_5);
+    EXPECT_EQ(FenFromPosition(position), kMateInThree);
+}
+
+TEST_F(IterativeDeepeningTestFixture, GivenNodeLimitOfOne_ExpectFirstIterationCompletedNonetheless)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.node_limit = 1;
+
+    // Call
+    const auto iterations = Search(abort_condition);
+
+    // Expect
+    ASSERT_EQ(iterations.size(), 1);
+    EXPECT_EQ(iterations.front().depth, 1);
+    EXPECT_NE(iterations.front().best_move, kBitNullMove);
+    EXPECT_EQ(principal_variation.GetMove(0), iterations.front().best_move);
+}
+
+TEST_F(IterativeDeepeningTestFixture, GivenMultiPv_ExpectDistinctLinesInDecreasingOrder)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.maximum_search_depth = 4;
+    constexpr std::size_t number_of_lines{3};
+
+    // Call
+    const auto iterations = Search(abort_condition, number_of_lines);
+
+    // Expect
+    ASSERT_EQ(iterations.size(), 4);
+    for (const IterationResult& iteration : iterations)
+    {
+        ASSERT_EQ(iteration.lines.size(), number_of_lines);
+        EXPECT_EQ(iteration.lines.front().move, iteration.best_move);
+        EXPECT_EQ(iteration.lines.front().evaluation, iteration.evaluation);
+        for (std::size_t line{0}; line < number_of_lines; line++)
+        {
+            ASSERT_FALSE(iteration.lines[line].principal_variation.empty());
+            EXPECT_EQ(iteration.lines[line].principal_variation.front(), iteration.lines[line].move);
+            if (line > 0)
+            {
+                EXPECT_NE(iteration.lines[line].move, iteration.lines[line - 1].move);
+                EXPECT_LE(iteration.lines[line].evaluation, iteration.lines[line - 1].evaluation);
+            }
+        }
+    }
+    EXPECT_EQ(principal_variation.GetMove(0), iterations.back().best_move);
+}
+
+TEST_F(IterativeDeepeningTestFixture, GivenMultiPv_ExpectSameBestLineAsSinglePv)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.maximum_search_depth = 6;
+
+    // Call
+    const auto single_pv = Search(abort_condition);
+    const auto multi_pv = Search(abort_condition, 2);
+
+    // Expect
+    EXPECT_EQ(single_pv.back().best_move, multi_pv.back().best_move);
+    EXPECT_EQ(single_pv.back().evaluation, multi_pv.back().evaluation);
+    EXPECT_EQ(single_pv.back().lines.front().principal_variation, multi_pv.back().lines.front().principal_variation);
+}
+
+TEST_F(IterativeDeepeningTestFixture, GivenReportCallback_ExpectCalledForEveryCompletedIteration)
+{
+    // Setup
+    AbortCondition abort_condition{};
+    abort_condition.maximum_search_depth = 3;
+    std::vector<std::size_t> reported_depths{};
+    principal_variation.Clear();
+    root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+
+    // Call
+    std::ignore = IterativeDeepening<GenerateAllPseudoLegalMoves, EvaluateMaterial>(
+        position,
+        principal_variation,
+        hash_history,
+        root_moves,
+        move_stack.begin(),
+        kNegamaxSignForMateInThree,
+        abort_condition,
+        statistic,
+        1,
+        [&reported_depths](const IterationResult& iteration) { reported_depths.push_back(iteration.depth); });
+
+    // Expect
+    EXPECT_EQ(reported_depths, (std::vector<std::size_t>{1, 2, 3}));
+}
+
+TEST(PredictDurationOfNextIterationTest, GivenLessThanTwoIterations_ExpectNoPrediction)
+{
+    EXPECT_EQ(PredictDurationOfNextIteration({}), std::chrono::microseconds{0});
+    EXPECT_EQ(PredictDurationOfNextIteration({{1, kBitNullMove, 0, 100, std::chrono::microseconds{1000}}}),
+              std::chrono::microseconds{0});
+}
+
+TEST(PredictDurationOfNextIterationTest, GivenTwoIterations_ExpectScaledByEffectiveBranchingFactor)
+{
+    // Setup
+    const std::vector<IterationResult> iterations{{1, kBitNullMove, 0, 100, std::chrono::microseconds{1000}},
+                                                  {2, kBitNullMove, 0, 400, std::chrono::microseconds{2000}}};
+
+    // Call & Expect
+    EXPECT_EQ(PredictDurationOfNextIteration(iterations), std::chrono::microseconds{8000});
+}
+
+}  // namespace
+}  // namespace Chess
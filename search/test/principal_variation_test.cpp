@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 namespace Chess
 {
 namespace
@@ -12,24 +14,96 @@ TEST(ClearSublines, GivenCall_ExpectMainLineUnalteredAndSublinesCleared)
     // Setup
     PrincipalVariation principal_variation{};
     constexpr Bitmove arbirtary_move{42};
-    principal_variation.fill(arbirtary_move);
+    principal_variation.PromoteSubline(2, arbirtary_move);
+    principal_variation.PromoteSubline(1, arbirtary_move);
+    principal_variation.PromoteSubline(0, arbirtary_move);
 
     // Call
-    ClearSublines(principal_variation);
+    principal_variation.ClearSublines();
 
     // Expect
-    for (std::size_t index{0}; index < principal_variation.size(); index++)
+    EXPECT_EQ(principal_variation.GetMainLine(), std::vector<Bitmove>(3, arbirtary_move));
+    for (std::size_t ply{1}; ply < kMaximumLengthOfPrincipalVariation; ply++)
     {
-        if (index < GetSublineIndexAtDepth(1))
-        {
-            EXPECT_EQ(principal_variation[index], arbirtary_move);
-        }
-        else
-        {
-            EXPECT_EQ(principal_variation[index], kBitNullMove);
-        }
+        EXPECT_FALSE(principal_variation.HasLine(ply)) << "ply: " << ply;
     }
 }
 
+TEST(PromoteSubline, GivenSubline_ExpectMovePrependedToIt)
+{
+    // Setup
+    PrincipalVariation principal_variation{};
+    principal_variation.PromoteSubline(5, Bitmove{3});
+    principal_variation.PromoteSubline(4, Bitmove{2});
+
+    // Call
+    principal_variation.PromoteSubline(3, Bitmove{1});
+
+    // Expect
+    const PrincipalVariationLine& line = principal_variation.GetLine(3);
+    ASSERT_EQ(line.length, 3);
+    EXPECT_EQ(line.moves[0], Bitmove{1});
+    EXPECT_EQ(line.moves[1], Bitmove{2});
+    EXPECT_EQ(line.moves[2], Bitmove{3});
+}
+
+TEST(PromoteSubline, GivenClearedSubline_ExpectLineOfSingleMove)
+{
+    // Setup
+    PrincipalVariation principal_variation{};
+    principal_variation.PromoteSubline(1, Bitmove{2});
+    principal_variation.ClearLine(1);
+
+    // Call
+    principal_variation.PromoteSubline(0, Bitmove{1});
+
+    // Expect
+    EXPECT_EQ(principal_variation.GetMainLine(), (std::vector<Bitmove>{Bitmove{1}}));
+    EXPECT_EQ(principal_variation.GetMove(1), kBitNullMove);
+}
+
+TEST(PromoteSubline, GivenLineOfMaximumLength_ExpectAllMovesInMainLine)
+{
+    // Setup
+    PrincipalVariation principal_variation{};
+
+    // Call
+    for (std::size_t ply{kMaximumLengthOfPrincipalVariation}; ply-- > 0;)
+    {
+        principal_variation.PromoteSubline(ply, Bitmove{static_cast<Bitmove>(ply + 1)});
+    }
+
+    // Expect
+    std::vector<Bitmove> expected_main_line(kMaximumLengthOfPrincipalVariation);
+    std::iota(begin(expected_main_line), end(expected_main_line), Bitmove{1});
+    EXPECT_EQ(principal_variation.GetMainLine(), expected_main_line);
+}
+
+TEST(PrincipalVariationBoundsCheck, GivenPlyBeyondMaximumLength_ExpectThrowsOutOfRange)
+{
+    PrincipalVariation principal_variation{};
+    EXPECT_THROW(std::ignore = principal_variation.GetMove(kMaximumLengthOfPrincipalVariation), std::out_of_range);
+    EXPECT_THROW(principal_variation.PromoteSubline(kMaximumLengthOfPrincipalVariation, Bitmove{1}),
+                 std::out_of_range);
+    EXPECT_NO_THROW(principal_variation.PromoteSubline(kMaximumLengthOfPrincipalVariation - 1, Bitmove{1}));
+}
+
+TEST(SetMainLine, GivenLine_ExpectOnlyMainLineSet)
+{
+    // Setup
+    PrincipalVariation principal_variation{};
+    principal_variation.PromoteSubline(1, Bitmove{7});
+    const std::vector<Bitmove> main_line{Bitmove{1}, Bitmove{2}};
+
+    // Call
+    principal_variation.SetMainLine(main_line);
+
+    // Expect
+    EXPECT_EQ(principal_variation.GetMainLine(), main_line);
+    EXPECT_EQ(principal_variation.GetMove(1), Bitmove{2});
+    EXPECT_EQ(principal_variation.GetMove(2), kBitNullMove);
+    EXPECT_FALSE(principal_variation.HasLine(1));
+}
+
 }  // namespace
 }  // namespace Chess
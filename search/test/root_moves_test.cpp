@@ -0,0 +1,200 @@
+#include "search/root_moves.h"
+
+#include "bitboard/fen_conversion.h"
+#include "bitboard/generate_moves.h"
+#include "bitboard/uci_conversion.h"
+#include "evaluate/evaluate.h"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace
+{
+
+TEST(GenerateRootMovesTest, GivenStandardPosition_ExpectAllTwentyMoves)
+{
+    Position position{PositionFromFen(kStandardStartingPosition)};
+    MoveStack move_stack{};
+    EXPECT_EQ(GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin()).size(), 20);
+}
+
+TEST(GenerateRootMovesTest, GivenStalemate_ExpectNoMoves)
+{
+    Position position{PositionFromFen("8/8/8/8/8/2k1q3/8/3K4 w - - 0 1")};
+    MoveStack move_stack{};
+    EXPECT_TRUE(GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin()).empty());
+}
+
+TEST(GenerateRootMovesTest, GivenCheck_ExpectOnlyLegalMoves)
+{
+    Position position{PositionFromFen("4k3/8/8/8/8/8/8/K3r3 w - - 0 1")};
+    MoveStack move_stack{};
+    const auto root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+    ASSERT_EQ(root_moves.size(), 2);
+    EXPECT_EQ(ToUciString(root_moves[0].move).substr(0, 2), "a1");
+    EXPECT_EQ(ToUciString(root_moves[1].move).substr(0, 2), "a1");
+}
+
+TEST(SortRootMovesTest, GivenNodeCounts_ExpectBestMoveFirstThenDecreasingNodeCounts)
+{
+    // Setup
+    constexpr Bitmove best_move{1};
+    RootMoves root_moves{{best_move, 0, 5}, {Bitmove{2}, 0, 10}, {Bitmove{3}, 0, 30}, {Bitmove{4}, 0, 20}};
+
+    // Call
+    SortRootMoves(root_moves, 1);
+
+    // Expect
+    ASSERT_EQ(root_moves.size(), 4);
+    EXPECT_EQ(root_moves[0].move, best_move);
+    EXPECT_EQ(root_moves[1].move, Bitmove{3});
+    EXPECT_EQ(root_moves[2].move, Bitmove{4});
+    EXPECT_EQ(root_moves[3].move, Bitmove{2});
+}
+
+TEST(SortRootMovesTest, GivenSeveralBestMoves_ExpectTheirOrderAndLinesKept)
+{
+    // Setup
+    RootMoves root_moves{{Bitmove{1}, 0, 5, {Bitmove{1}}},
+                         {Bitmove{2}, 0, 1, {Bitmove{2}}},
+                         {Bitmove{3}, 0, 30, {Bitmove{3}}},
+                         {Bitmove{4}, 0, 20}};
+
+    // Call
+    SortRootMoves(root_moves, 2);
+
+    // Expect
+    ASSERT_EQ(root_moves.size(), 4);
+    EXPECT_EQ(root_moves[0].move, Bitmove{1});
+    EXPECT_EQ(root_moves[1].move, Bitmove{2});
+    EXPECT_EQ(root_moves[2].move, Bitmove{3});
+    EXPECT_EQ(root_moves[3].move, Bitmove{4});
+    EXPECT_EQ(root_moves[1].principal_variation.size(), 1);
+    EXPECT_TRUE(root_moves[2].principal_variation.empty());
+}
+
+TEST(SearchRootMovesTest, GivenMateInThree_ExpectMateFoundAndNodesAccountedPerRootMove)
+{
+    // Setup
+    constexpr const char* const mate_in_three = "7r/Q1p2ppp/1p3k2/1Bb5/5q2/2N5/PPPrR1KP/R7 b - - 2 21";
+    Position position{PositionFromFen(mate_in_three)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    constexpr Evaluation negamax_sign{-1};
+    constexpr std::size_t full_search_depth = 6;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+    RootMoves root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+
+    // Call
+    const auto evaluation =
+        SearchRootMoves<GenerateAllPseudoLegalMoves, EvaluateMaterial>(position,
+                                                                       principal_variation,
+                                                                       hash_history,
+                                                                       begin(root_moves),
+                                                                       end(root_moves),
+                                                                       move_stack.begin(),
+                                                                       negamax_sign,
+                                                                       abort_condition,
+                                                                       statistic);
+
+    // Expect
+    EXPECT_EQ(evaluation, MateIn(5));
+    EXPECT_EQ(ToUciString(principal_variation.GetMove(0)), "f4g4");
+    EXPECT_EQ(ToUciString(root_moves.front().move), "f4g4");
+    const auto nodes_below_root = std::accumulate(
+        begin(root_moves), end(root_moves), std::size_t{0}, [](const auto sum, const auto& root_move) {
+            return sum + root_move.number_of_nodes;
+        });
+    EXPECT_EQ(nodes_below_root + 1, statistic.number_of_nodes);
+    EXPECT_EQ(FenFromPosition(position), mate_in_three);
+}
+
+TEST(SearchRootMovesTest, GivenFirstMoveExcludedFromRange_ExpectAnotherMove)
+{
+    // Setup
+    constexpr const char* const mate_in_three = "7r/Q1p2ppp/1p3k2/1Bb5/5q2/2N5/PPPrR1KP/R7 b - - 2 21";
+    Position position{PositionFromFen(mate_in_three)};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    constexpr Evaluation negamax_sign{-1};
+    constexpr std::size_t full_search_depth = 4;
+    constexpr Chess::AbortCondition abort_condition{full_search_depth};
+    RootMoves root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+    std::iter_swap(begin(root_moves),
+                   std::find_if(begin(root_moves), end(root_moves), [](const auto& root_move) {
+                       return ToUciString(root_move.move) == "f4g4";
+                   }));
+
+    // Call
+    std::ignore = SearchRootMoves<GenerateAllPseudoLegalMoves, EvaluateMaterial>(position,
+                                                                                 principal_variation,
+                                                                                 hash_history,
+                                                                                 std::next(begin(root_moves)),
+                                                                                 end(root_moves),
+                                                                                 move_stack.begin(),
+                                                                                 negamax_sign,
+                                                                                 abort_condition,
+                                                                                 statistic);
+
+    // Expect
+    EXPECT_NE(principal_variation.GetMove(0), kBitNullMove);
+    EXPECT_NE(ToUciString(principal_variation.GetMove(0)), "f4g4");
+    EXPECT_EQ(ToUciString(root_moves.front().move), "f4g4");
+    EXPECT_EQ(root_moves[1].move, principal_variation.GetMove(0));
+}
+
+TEST(SearchRootMovesTest, GivenSeveralMoves_ExpectOnlyRepliesToLaterMovesAreExpectedCutNodes)
+{
+    // Setup
+    Position position{PositionFromFen("4k3/8/8/8/8/8/8/R3K3 w - - 0 1")};
+    HashHistory hash_history{position};
+    PrincipalVariation principal_variation{};
+    SearchStatistic statistic{};
+    MoveStack move_stack{};
+    constexpr Chess::AbortCondition abort_condition{1};
+    RootMoves root_moves = GenerateRootMoves<GenerateAllPseudoLegalMoves>(position, move_stack.begin());
+    ASSERT_GT(root_moves.size(), 2);
+
+    // Call
+    testing::internal::CaptureStdout();
+    std::ignore = SearchRootMoves<GenerateAllPseudoLegalMoves, EvaluateMaterial, DebuggingEnabled>(
+        position,
+        principal_variation,
+        hash_history,
+        begin(root_moves),
+        end(root_moves),
+        NextMoveList(move_stack.begin()),
+        1,
+        abort_condition,
+        statistic);
+    std::istringstream debugging_output{testing::internal::GetCapturedStdout()};
+
+    // Expect
+    std::vector<std::string> entries_of_replies{};
+    for (std::string line{}; std::getline(debugging_output, line);)
+    {
+        if (line.starts_with("entering depth 1"))
+        {
+            entries_of_replies.push_back(line);
+        }
+    }
+    ASSERT_EQ(entries_of_replies.size(), root_moves.size());
+    EXPECT_EQ(entries_of_replies.front(), "entering depth 1");
+    for (auto entry = std::next(begin(entries_of_replies)); entry != end(entries_of_replies); entry++)
+    {
+        EXPECT_EQ(*entry, "entering depth 1 (expected cut node)");
+    }
+}
+
+}  // namespace
+}  // namespace Chess
@@ -42,6 +42,70 @@ TEST_P(TraverseAllLeavesTestFixture, GivenDepth_ExpectCorrectNumberOfEvaluations
               << std::endl;
 }
 
+TEST_P(TraverseAllLeavesTestFixture, GivenDepth_ExpectSameNumberOfLeavesWhenCountingInBulk)
+{
+    // Setup
+    Position position = PositionFromFen(GetFen());
+    MoveStack move_stack{};
+    Statistic stats{};
+    const Chess::AbortCondition abort_condition{GetDepth()};
+
+    // Call
+    CountAllLeavesInBulk<GenerateAllPseudoLegalMoves>(position, move_stack.begin(), stats, abort_condition);
+
+    // Expect
+    EXPECT_EQ(GetExpectedNumberOfLeaves(), stats.number_of_evaluations);
+    EXPECT_EQ(FenFromPosition(position), FenFromPosition(PositionFromFen(GetFen())));
+}
+
+TEST_P(TraverseAllLeavesTestFixture, GivenDepth_ExpectSameNumberOfEvaluationsWithCopyMake)
+{
+    // Setup
+    Position position = PositionFromFen(GetFen());
+    MoveStack move_stack{};
+    Statistic stats{};
+    const Chess::AbortCondition abort_condition{GetDepth()};
+
+    // Call
+    TraverseAllLeaves<GenerateAllPseudoLegalMoves, CopyAndMakeMoves>(
+        position, move_stack.begin(), stats, abort_condition);
+
+    // Expect
+    EXPECT_EQ(GetExpectedNumberOfLeaves(), stats.number_of_evaluations);
+}
+
+TEST_P(TraverseAllLeavesTestFixture, GivenDepth_ExpectSameNumberOfEvaluationsWithRecomputedAttackMaps)
+{
+    // Setup
+    Position position = PositionFromFen(GetFen());
+    MoveStack move_stack{};
+    Statistic stats{};
+    const Chess::AbortCondition abort_condition{GetDepth()};
+
+    // Call
+    TraverseAllLeavesWithAttackMaps<GenerateAllPseudoLegalMoves, RecomputeAttackMaps>(
+        position, ComputeAttackMaps(position), move_stack.begin(), stats, abort_condition);
+
+    // Expect
+    EXPECT_EQ(GetExpectedNumberOfLeaves(), stats.number_of_evaluations);
+}
+
+TEST_P(TraverseAllLeavesTestFixture, GivenDepth_ExpectSameNumberOfEvaluationsWithIncrementalAttackMaps)
+{
+    // Setup
+    Position position = PositionFromFen(GetFen());
+    MoveStack move_stack{};
+    Statistic stats{};
+    const Chess::AbortCondition abort_condition{GetDepth()};
+
+    // Call
+    TraverseAllLeavesWithAttackMaps<GenerateAllPseudoLegalMoves, UpdateAttackMapsIncrementally>(
+        position, ComputeAttackMaps(position), move_stack.begin(), stats, abort_condition);
+
+    // Expect
+    EXPECT_EQ(GetExpectedNumberOfLeaves(), stats.number_of_evaluations);
+}
+
 // Numbers taken from https://www.chessprogramming.org/Perft_Results
 const char* const pos2_fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
 const char* const pos3_fen = "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1";
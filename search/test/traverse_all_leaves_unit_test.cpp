@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <iterator>
 #include <type_traits>
 
 namespace Chess
@@ -16,6 +17,7 @@ struct GenerateTwoMovesWithUniqueDebugId
 template <typename Behavior = GenerateTwoMovesWithUniqueDebugId>
 std::enable_if_t<Behavior::generate_two_moves_with_unique_debug_id, MoveStack::iterator> GenerateMoves(
     const Position& /*unused*/,
+    const CheckState& /*unused*/,
     MoveStack::iterator move_generation_insertion_iterator)
 {
     static Bitmove unique_id{1};
@@ -27,7 +29,7 @@ std::enable_if_t<Behavior::generate_two_moves_with_unique_debug_id, MoveStack::i
 namespace
 {
 
-TEST(MoveListTest, GivenDepth3_ExpectDebuggingIdsOf6LastVisitedMovesInMoveStack)
+TEST(MoveListTest, GivenDepth3_ExpectDebuggingIdsOfLastVisitedMovesInMoveListOfEachPly)
 {
     // Setup
     Position position{};
@@ -40,10 +42,12 @@ TEST(MoveListTest, GivenDepth3_ExpectDebuggingIdsOf6LastVisitedMovesInMoveStack)
     TraverseAllLeaves<GenerateTwoMovesWithUniqueDebugId>(position, move_stack.begin(), stats, abort_condition);
 
     // Expect
-    const std::array<Bitmove, 6> expected_debugging_ids{1, 2, 9, 10, 13, 14};  // worked out by hand
-    for (std::size_t idx{0}; idx < expected_debugging_ids.size(); idx++)
+    const std::array<std::array<Bitmove, 2>, 3> expected_debugging_ids{{{1, 2}, {9, 10}, {13, 14}}};  // by hand
+    for (std::size_t ply{0}; ply < expected_debugging_ids.size(); ply++)
     {
-        EXPECT_EQ(expected_debugging_ids.at(idx), move_stack.at(idx));
+        const MoveStack::iterator begin_of_move_list = move_stack.begin() + ply * kMoveListCapacity;
+        EXPECT_EQ(expected_debugging_ids.at(ply).at(0), *begin_of_move_list);
+        EXPECT_EQ(expected_debugging_ids.at(ply).at(1), *std::next(begin_of_move_list));
     }
 }
 
@@ -1,6 +1,9 @@
 #ifndef SEACH_TRAVERSE_ALL_LEAVES_H
 #define SEACH_TRAVERSE_ALL_LEAVES_H
 
+#include "bitboard/attack_maps.h"
+#include "bitboard/check_state.h"
+#include "bitboard/copy_make.h"
 #include "bitboard/move_stack.h"
 #include "bitboard/position.h"
 #include "search/abort_condition.h"
@@ -17,12 +20,13 @@ struct Statistic
 
 template <typename GenerateBehavior>
 std::enable_if_t<GenerateBehavior::not_defined, const MoveStack::iterator> GenerateMoves(const Position&,
+                                                                                         const CheckState&,
                                                                                          MoveStack::iterator);
 
 /// @brief A search without pruning that visits all leaf nodes.
 ///
-/// Used for debugging and benchmarking move generation.
-template <typename GenerateBehavior>
+/// Used for debugging and benchmarking move generation (and the way moves are made, see MakeAndUnmakeMoves).
+template <typename GenerateBehavior, typename MakeBehavior = MakeAndUnmakeMoves>
 void TraverseAllLeaves(Position& position,
                        const MoveStack::iterator& end_iterator_before_move_generation,
                        Statistic& stats,
@@ -35,22 +39,110 @@ void TraverseAllLeaves(Position& position,
         return;
     }
 
+    const MoveStack::iterator end_iterator_after_move_generation =
+        GenerateMoves<GenerateBehavior>(position, ComputeCheckState(position), end_iterator_before_move_generation);
+
+    for (MoveStack::iterator move_iterator = end_iterator_before_move_generation;
+         move_iterator != end_iterator_after_move_generation;
+         move_iterator++)
+    {
+        Bitboard saved_extras{};
+        Position& child_position = MakeMoveForChild<MakeBehavior>(position, *move_iterator, depth + 1, saved_extras);
+        TraverseAllLeaves<GenerateBehavior, MakeBehavior>(
+            child_position, NextMoveList(end_iterator_before_move_generation), stats, abort_condition, depth + 1);
+        UnmakeMoveForChild<MakeBehavior>(position, *move_iterator, saved_extras);
+    }
+    return;
+}
+
+/// @brief Counts the same leaf nodes as TraverseAllLeaves (i.e. perft), but counts the last ply in bulk.
+///
+/// Nodes one ply above the leaves only count their legal moves instead of making and unmaking each of them.
+template <typename GenerateBehavior>
+void CountAllLeavesInBulk(Position& position,
+                          const MoveStack::iterator& end_iterator_before_move_generation,
+                          Statistic& stats,
+                          const AbortCondition& abort_condition,
+                          const std::size_t depth = 0)
+{
+    if (depth == abort_condition.full_search_depth)
+    {
+        stats.number_of_evaluations++;
+        return;
+    }
+
+    const MoveStack::iterator end_iterator_after_move_generation =
+        GenerateMoves<GenerateBehavior>(position, ComputeCheckState(position), end_iterator_before_move_generation);
+
+    const bool children_are_leaves = (depth + 1) == abort_condition.full_search_depth;
+    if (children_are_leaves)
+    {
+        stats.number_of_evaluations += end_iterator_after_move_generation - end_iterator_before_move_generation;
+        return;
+    }
+    for (MoveStack::iterator move_iterator = end_iterator_before_move_generation;
+         move_iterator != end_iterator_after_move_generation;
+         move_iterator++)
+    {
+        const Bitboard saved_extras = position.MakeMove(*move_iterator);
+        CountAllLeavesInBulk<GenerateBehavior>(
+            position, NextMoveList(end_iterator_before_move_generation), stats, abort_condition, depth + 1);
+        position.UnmakeMove(*move_iterator, saved_extras);
+    }
+}
+
+/// @brief Visits the same leaf nodes as TraverseAllLeaves, but tells legal moves by the attack maps of each node.
+///
+/// Used for benchmarking the ways to keep attack maps from node to node (see RecomputeAttackMaps and
+/// UpdateAttackMapsIncrementally).
+template <typename GenerateBehavior, typename AttackMapsBehavior>
+void TraverseAllLeavesWithAttackMaps(Position& position,
+                                     const AttackMaps& attack_maps,
+                                     const MoveStack::iterator& end_iterator_before_move_generation,
+                                     Statistic& stats,
+                                     const AbortCondition& abort_condition,
+                                     const std::size_t depth = 0)
+{
+    if (depth == abort_condition.full_search_depth)
+    {
+        stats.number_of_evaluations++;
+        return;
+    }
+
     const MoveStack::iterator end_iterator_after_move_generation =
         GenerateMoves<GenerateBehavior>(position, end_iterator_before_move_generation);
 
+    const std::size_t own_side = position.GetAttackingSide();
+    const Bitboard squares_attacked_by_opponent = attack_maps[position.GetDefendingSide()];
     for (MoveStack::iterator move_iterator = end_iterator_before_move_generation;
          move_iterator != end_iterator_after_move_generation;
          move_iterator++)
     {
+        const Bitmove move_type = *move_iterator & kMoveMaskType;
+        if ((move_type == kMoveTypeKingsideCastling) || (move_type == kMoveTypeQueensideCastling))
+        {
+            const Bitboard king = position[own_side + kKing];
+            const Bitboard pass_through_square = (move_type == kMoveTypeKingsideCastling) ? king >> 1 : king << 1;
+            if (squares_attacked_by_opponent & (king | pass_through_square))
+            {
+                continue;
+            }
+        }
         const Bitboard saved_extras = position.MakeMove(*move_iterator);
-        if (!position.IsKingInCheck(position.defending_side_))
+        const AttackMaps child_attack_maps =
+            ComputeAttackMapsOfChild<AttackMapsBehavior>(attack_maps, position, *move_iterator);
+        if (!IsKingAttacked(position, child_attack_maps, own_side))
         {
-            TraverseAllLeaves<GenerateBehavior>(
-                position, end_iterator_after_move_generation, stats, abort_condition, depth + 1);
+            TraverseAllLeavesWithAttackMaps<GenerateBehavior, AttackMapsBehavior>(
+                position,
+                child_attack_maps,
+                NextMoveList(end_iterator_before_move_generation),
+                stats,
+                abort_condition,
+                depth + 1);
         }
         position.UnmakeMove(*move_iterator, saved_extras);
     }
-    return;
 }
 
 }  // namespace Chess